@@ -0,0 +1,10 @@
+#version 330 core
+out vec4 FragColor;
+in vec3 finalColor;
+in vec3 normal;
+const vec3 lightDirection = normalize(vec3(0.4, 0.7, -0.6));
+void main()
+{
+    float diffuse = max(dot(normalize(normal), lightDirection), 0.0);
+    FragColor = vec4(finalColor * (0.3 + 0.7 * diffuse), 1.0);
+}
@@ -0,0 +1,60 @@
+#version 330 core
+// En : Procedural circles, cylinders and cones. There are no vertex attributes, the primitive is the high bits of gl_VertexID and the vertex of it the low bits.
+// Tr : Prosedürel daireler, silindirler ve koniler. Köşe niteliği yoktur, ilkel gl_VertexID'nin yüksek bitleri, onun köşesi düşük bitleridir.
+// En : World matrices of the objects, four texels per object, one for every column.
+// Tr : Nesnelerin dünya matrisleri, nesne başına dört teksel, her sütun için bir tane.
+uniform samplerBuffer objectMatrices;
+// En : Materials of the objects, one texel per object.
+// Tr : Nesnelerin malzemeleri, nesne başına bir teksel.
+uniform samplerBuffer objectMaterials;
+// En : Six texels per primitive : the columns of its transform, (radius, height, resolution, type) and the bits of its object index.
+// Tr : İlkel başına altı teksel : dönüşümünün sütunları, (radius, height, resolution, type) ve nesne indisinin bitleri.
+uniform samplerBuffer primitives;
+uniform int primitiveShift;
+out vec3 finalColor;
+out vec3 normal;
+const float PI = 3.14159265358979;
+// En : Corners of the faces of a segment as step * 4 + level. Levels are 0 bottom ring, 1 top ring, 2 bottom center, 3 top center. The faces are wound like the meshed primitives.
+// Tr : Bir dilimin yüzlerinin köşeleri step * 4 + level olarak. Seviyeler 0 alt halka, 1 üst halka, 2 alt merkez, 3 üst merkezdir. Yüzler ağ ilkelleri gibi sarılır.
+const int circleCorners[3] = int[](0, 4, 2);
+const int cylinderCorners[12] = int[](0, 5, 4, 0, 1, 5, 0, 4, 2, 5, 1, 3);
+const int coneCorners[6] = int[](0, 4, 3, 4, 0, 2);
+mat4 ObjectMatrix(int object)
+{
+    int base = object * 4;
+    return mat4(texelFetch(objectMatrices, base), texelFetch(objectMatrices, base + 1), texelFetch(objectMatrices, base + 2), texelFetch(objectMatrices, base + 3));
+}
+void main()
+{
+    int base = (gl_VertexID >> primitiveShift) * 6;
+    int local = gl_VertexID & ((1 << primitiveShift) - 1);
+    mat4 element = mat4(texelFetch(primitives, base), texelFetch(primitives, base + 1), texelFetch(primitives, base + 2), texelFetch(primitives, base + 3));
+    vec4 parameters = texelFetch(primitives, base + 4);
+    int object = floatBitsToInt(texelFetch(primitives, base + 5).x);
+    float radius = parameters.x, height = parameters.y;
+    int resolution = int(parameters.z), type = int(parameters.w);
+
+    int triangle = local / 3, corner = local % 3, faces = type == 0 ? 1 : (type == 1 ? 4 : 2);
+    int segment = triangle / faces, face = triangle % faces;
+    int code = type == 0 ? circleCorners[corner] : (type == 1 ? cylinderCorners[face * 3 + corner] : coneCorners[face * 3 + corner]);
+    int level = code % 4;
+    float angle = 2.0 * PI * float((segment + code / 4) % resolution) / float(resolution);
+    float y = (level == 1 || level == 3) ? height / 2.0 : -height / 2.0;
+    vec3 position = level < 2 ? vec3(radius * cos(angle), y, radius * sin(angle)) : vec3(0.0, y, 0.0);
+
+    // En : Caps have flat normals, sides radial ones. The apex of a cone takes the normal of the middle of its segment.
+    // Tr : Kapakların düz, yanların radyal normalleri vardır. Koninin tepesi diliminin ortasının normalini alır.
+    vec3 n;
+    if (type == 0 || (type == 1 && face >= 2) || (type == 2 && face == 1))
+        n = vec3(0.0, (type == 1 && face == 3) ? 1.0 : -1.0, 0.0);
+    else
+    {
+        float side = level == 3 ? 2.0 * PI * (float(segment) + 0.5) / float(resolution) : angle;
+        n = type == 1 ? vec3(cos(side), 0.0, sin(side)) : normalize(vec3(height * cos(side), radius, height * sin(side)));
+    }
+
+    mat4 model = ObjectMatrix(object) * element;
+    gl_Position = model * vec4(position, 1.0);
+    finalColor = texelFetch(objectMaterials, object).rgb;
+    normal = transpose(inverse(mat3(model))) * n;
+}
@@ -1,12 +1,24 @@
 #version 330 core
 in vec2 TexCoords;
+in vec3 TextColor;
 out vec4 color;
 
 uniform sampler2D text;
+// En : Tint of every text, multiplied with the color of the text from its vertices.
+// Tr : Her metnin tonu, metnin köşelerinden gelen rengiyle çarpılır.
 uniform vec3 textColor;
+// En : 1 when the glyphs are signed distance fields. The edge is at 0.5 and is smoothed over one screen pixel at any scale.
+// Tr : Glifler işaretli uzaklık alanı ise 1. Kenar 0.5'tedir ve her ölçekte bir ekran pikseli boyunca yumuşatılır.
+uniform int distanceField;
 
 void main()
 {
-    vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, TexCoords).r);
-    color = vec4(TexCoords, 1.0) * sampled;
-}
\ No newline at end of file
+    float value = texture(text, TexCoords).r;
+    if (distanceField == 1)
+    {
+        float width = max(fwidth(value) * 0.5, 1e-4);
+        value = smoothstep(0.5 - width, 0.5 + width, value);
+    }
+    vec4 sampled = vec4(1.0, 1.0, 1.0, value);
+    color = vec4(textColor * TextColor, 1.0) * sampled;
+}
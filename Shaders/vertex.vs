@@ -1,9 +1,21 @@
 #version 330 core
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 customColor;
+layout(location = 4) in int objectIndex;
+// En : World matrices of the objects, four texels per object, one for every column.
+// Tr : Nesnelerin dünya matrisleri, nesne başına dört teksel, her sütun için bir tane.
+uniform samplerBuffer objectMatrices;
+// En : Materials of the objects, one texel per object. The vertex color is white unless the scene has gradients.
+// Tr : Nesnelerin malzemeleri, nesne başına bir teksel. Sahnede gradyan yoksa köşe rengi beyazdır.
+uniform samplerBuffer objectMaterials;
 out vec3 finalColor;
+mat4 ObjectMatrix()
+{
+    int base = objectIndex * 4;
+    return mat4(texelFetch(objectMatrices, base), texelFetch(objectMatrices, base + 1), texelFetch(objectMatrices, base + 2), texelFetch(objectMatrices, base + 3));
+}
 void main()
 {
-    gl_Position = vec4(aPos, 1.0);
-    finalColor = customColor;
+    gl_Position = ObjectMatrix() * vec4(aPos, 1.0);
+    finalColor = customColor * texelFetch(objectMaterials, objectIndex).rgb;
 }
@@ -9,6 +9,26 @@
 #include "tinyxml2.cpp"
 #endif
 
+#include "resources/Memory.h"
+#ifdef MEMORY_H
+#include "resources/Memory.cpp"
+#endif
+
+#include "resources/State.h"
+#ifdef STATE_H
+#include "resources/State.cpp"
+#endif
+
+#include "resources/Frames.h"
+#ifdef FRAMES_H
+#include "resources/Frames.cpp"
+#endif
+
+#include "resources/Queue.h"
+#ifdef QUEUE_H
+#include "resources/Queue.cpp"
+#endif
+
 #include "resources/Shader.h"
 #include "resources/Shader.cpp"
 
@@ -17,195 +37,164 @@
 #include "resources/Object.cpp"
 #endif
 
+#include "resources/Scene.h"
+#include "resources/Material.h"
+#include "resources/Primitive.h"
+#include "resources/Animation.h"
+
 #include "resources/Analyze.cpp"
 #ifdef ANALYZE_H
 #include "resources/Analyze.h"
 #endif
 
-#include <ft2build.h>
-#include FT_FREETYPE_H
+#ifdef STREAMS_H
+#include "resources/Streams.cpp"
+#endif
 
-#include "resources/Text.h"
-#ifdef TEXT_H
-#include "resources/Text.cpp"
+#include "resources/Components.h"
+#ifdef COMPONENTS_H
+#include "resources/Components.cpp"
 #endif
 
-std::map<std::string, GLuint> attributeLocations{
-    {"position", 0},
-    {"color", 1},
-    {"normal", 2},
-    {"uv", 3}};
-std::map<std::string, GLuint> attributeSizes{
-    {"position", 3},
-    {"color", 3},
-    {"normal", 3},
-    {"uv", 2}};
+#ifdef SCENE_H
+#include "resources/Scene.cpp"
+#endif
 
-void ErrorCallback(int error, const char *description)
-{
-    std::cout << "Error: " << description << std::endl;
-}
+#ifdef MATERIAL_H
+#include "resources/Material.cpp"
+#endif
 
-void ErrorDebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *userParam)
-{
-    std::cout << "Error: " << message << std::endl;
-}
+#ifdef PRIMITIVE_H
+#include "resources/Primitive.cpp"
+#endif
 
-void PrepareAndLoadMeshData(MeshData data, GLuint &vertexArray, int &size)
-{
-    if (data.find("position") == data.end() || data.find("index") == data.end() || data.find("color") == data.end())
-    {
-        std::cout << "Data is not complete\n";
-        return;
-    }
+#include "resources/Jobs.h"
+#ifdef JOBS_H
+#include "resources/Jobs.cpp"
+#endif
 
-    std::vector<int> indices = std::get<std::vector<int>>(data["index"]);
-    size = indices.size();
-    int refSize = std::get<std::vector<glm::vec3>>(data["position"]).size();
-    std::map<std::string, int> offsets{
-        {"position", 0},
-        {"color", 3}};
+#ifdef IMPORT_H
+#include "resources/Import.cpp"
+#endif
 
-    int interval = 6;
+#ifdef EXPRESSION_H
+#include "resources/Expression.cpp"
+#endif
 
-    if (data.find("normal") != data.end())
-    {
-        interval += 3;
-        offsets["normal"] = interval;
-    }
-    if (data.find("uv") != data.end())
-    {
-        interval += 2;
-        offsets["uv"] = interval;
-    }
+#ifdef ANIMATION_H
+#include "resources/Animation.cpp"
+#endif
 
-#ifdef OBJECT_H
-    Interval = interval;
+#ifdef NORMALS_H
+#include "resources/Normals.cpp"
 #endif
 
-    float *originalData = new float[refSize * interval];
+#ifdef TRIANGULATE_H
+#include "resources/Triangulate.cpp"
+#endif
 
-    for (std::map<std::string, int>::iterator it = offsets.begin(); it != offsets.end(); ++it)
-    {
-        int offset = (*it).second;
-        std::string key = (*it).first;
-        if (std::holds_alternative<std::vector<glm::vec2>>(data[key]))
-        {
-            std::vector<glm::vec2> v2s = std::get<std::vector<glm::vec2>>(data[key]);
-            for (int i = 0; i < refSize; i++)
-            {
-                glm::vec2 v2 = v2s[i];
+#ifdef SURFACE_H
+#include "resources/Surface.cpp"
+#endif
 
-                originalData[i * interval + offset] = v2.x;
-                originalData[i * interval + offset + 1] = v2.y;
-            }
-        }
-        else if (std::holds_alternative<std::vector<glm::vec3>>(data[key]))
-        {
-            std::vector<glm::vec3> v3s = std::get<std::vector<glm::vec3>>(data[key]);
-            for (int i = 0; i < refSize; i++)
-            {
-                glm::vec3 v3 = v3s[i];
+#include "resources/BVH.h"
+#ifdef BVH_H
+#include "resources/BVH.cpp"
+#endif
 
-                originalData[i * interval + offset] = v3.x;
-                originalData[i * interval + offset + 1] = v3.y;
-                originalData[i * interval + offset + 2] = v3.z;
-            }
-        }
-    }
+#include "resources/Loader.h"
+#ifdef LOADER_H
+#include "resources/Loader.cpp"
+#endif
 
-#ifdef OBJECT_H
-    GlobalData = originalData;
-    GlobalDataElementSize = refSize * interval;
+#include "resources/Paging.h"
+#ifdef PAGING_H
+#include "resources/Paging.cpp"
 #endif
 
-    GLuint vertexBuffer, elementBuffer;
+#include <ft2build.h>
+#include FT_FREETYPE_H
 
-    glGenBuffers(1, &elementBuffer);
-    glGenBuffers(1, &vertexBuffer);
-    glGenVertexArrays(1, &vertexArray);
+#include "resources/Text.h"
+#ifdef TEXT_H
+#include "resources/Text.cpp"
+#endif
 
-    glBindVertexArray(vertexArray);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer);
+#ifdef BENCHMARK
+#include "resources/Regression.h"
+#ifdef REGRESSION_H
+#include "resources/Regression.cpp"
+#endif
+#endif
 
-    glBufferData(GL_ARRAY_BUFFER, refSize * interval * sizeof(float), originalData, GL_STATIC_DRAW);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size * sizeof(int), &indices.front(), GL_STATIC_DRAW);
+// En : std140 layout of the "Frame" uniform block shared by the programs.
+// Tr : Programlar tarafından paylaşılan "Frame" uniform bloğunun std140 düzeni.
+struct FrameUniforms
+{
+    glm::mat4 projection;
+};
 
-    for (std::map<std::string, int>::iterator it = offsets.begin(); it != offsets.end(); ++it)
-    {
-        try
-        {
-            GLuint location = attributeLocations[(*it).first];
-            GLuint size = attributeSizes[(*it).first];
-            glVertexAttribPointer(location, size, GL_FLOAT, GL_FALSE, interval * sizeof(float), (void *)((*it).second * sizeof(float)));
-            glEnableVertexAttribArray(location);
-        }
-        catch (const std::exception &e)
-        {
-            std::cout << "Error: " << (*it).first << "->" << (*it).second << std::endl;
-        }
-    }
+void ErrorCallback(int error, const char *description)
+{
+    std::cout << "Error: " << description << std::endl;
 }
 
-#ifdef TEXT_H
-void PrepareTextBuffer(std::vector<Text *> texts, GLuint &vertexArray, int &size)
+void ErrorDebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *userParam)
 {
-    int _size = 0;
-    for (Text *t : texts)
-    {
-        _size += t->GetQuadCount() * 24;
-    }
-    float *data = new float[_size];
-
-    for (int i = 0, j = 0; j < _size; i++)
-    {
-        Text *text = texts[i];
-        int count;
-        float *vertices = text->GetVertices(count);
-        for (int k = j; k < j + count; k++)
-            data[k] = vertices[k - j];
-        j += count;
-    }
-
-    _size = 0;
-    for (Text *t : texts)
-    {
-        _size += t->GetQuadCount();
-    }
-    GLuint *textures = new GLuint[_size];
-    for (int i = 0, j = 0; j < _size; i++)
-    {
-        int count;
-        GLuint *tex = texts[i]->GetTextures(count);
-        for (int k = j; k < j + count; k++)
-            textures[k] = tex[k - j];
-        j += count;
-    }
-
-    float *verts = new float[24];
-    for (int i = 0; i < 24; i++)
-        verts[i] = data[i];
-
-    size = 6;
+    std::cout << "Error: " << message << std::endl;
+}
 
-    GLuint vertexBuffer;
+// En : The contents of the window are lost when it is resized, exposed or restored, so a new frame is drawn.
+// Tr : Pencere yeniden boyutlandırıldığında, açığa çıktığında veya geri yüklendiğinde içeriği kaybolur, bu yüzden yeni bir kare çizilir.
+void FramebufferSizeCallback(GLFWwindow *window, int width, int height)
+{
+    GlobalFrames.RequestRedraw();
+}
 
-    glGenVertexArrays(1, &vertexArray);
-    glGenBuffers(1, &vertexBuffer);
+void WindowRefreshCallback(GLFWwindow *window)
+{
+    GlobalFrames.RequestRedraw();
+}
 
-    glBindVertexArray(vertexArray);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+#ifdef BVH_H
+void MouseButtonCallback(GLFWwindow *window, int button, int action, int mods)
+{
+    if (button != GLFW_MOUSE_BUTTON_LEFT || action != GLFW_PRESS)
+        return;
+    BVH *bvh = static_cast<BVH *>(glfwGetWindowUserPointer(window));
+    double x, y;
+    int width, height;
+    glfwGetCursorPos(window, &x, &y);
+    glfwGetWindowSize(window, &width, &height);
+    RayHit hit;
+    if (bvh && bvh->Intersect(ScreenRay(glm::vec2(x, y), glm::ivec2(width, height)), hit))
+        std::cout << "Picked object " << hit.object << ", triangle " << hit.triangle << std::endl;
+}
+#endif
 
-    glBufferData(GL_ARRAY_BUFFER, sizeof(verts) * sizeof(float), verts, GL_STATIC_DRAW);
+#ifdef TEXT_H
+// En : Whether the frame counters are drawn over the scene. Toggled with F3.
+// Tr : Kare sayaçlarının sahnenin üzerine çizilip çizilmeyeceği. F3 ile açılıp kapatılır.
+bool ShowFrameStats = false;
 
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
+void KeyCallback(GLFWwindow *window, int key, int scancode, int action, int mods)
+{
+    if (key == GLFW_KEY_F3 && action == GLFW_PRESS)
+    {
+        ShowFrameStats = !ShowFrameStats;
+        GlobalFrames.RequestRedraw();
+    }
 }
 #endif
 
-int main()
+int main(int argc, char **argv)
 {
+#ifdef BENCHMARK
+    // En : Benchmark builds time the CPU side algorithms, then run the regression suite in a hidden window and exit with its result.
+    // Tr : Kıyaslama derlemeleri işlemci tarafı algoritmaların süresini ölçer, ardından gerileme paketini gizli bir pencerede çalıştırır ve sonucuyla çıkar.
+    BenchmarkTriangulation();
+    return RunRegressionSuite(argc, argv);
+#endif
 
     glfwInit();
 
@@ -233,18 +222,86 @@ int main()
     glfwSetErrorCallback(ErrorCallback);
     glDebugMessageCallback(ErrorDebugCallback, nullptr);
 
+    // En : Frames are drawn only when the image changes. Loading, animations and the frame counters keep requesting frames while they run.
+    // Tr : Kareler yalnızca görüntü değiştiğinde çizilir. Yükleme, animasyonlar ve kare sayaçları çalıştıkları sürece kare ister.
+    GlobalFrames.SetMode(RenderMode::OnDemand);
+    glfwSetFramebufferSizeCallback(window, FramebufferSizeCallback);
+    glfwSetWindowRefreshCallback(window, WindowRefreshCallback);
+
     Shader *meshShader = new Shader("Shaders\\vertex.vs", "Shaders\\fragment.fs");
 
-    tinyxml2::XMLDocument *doc = new tinyxml2::XMLDocument();
-    doc->LoadFile("test.xml");
-    MeshData md;
-    AnalyzeTag(doc->RootElement(), md);
-    GLuint meshVertexArray;
-    int meshSize;
-    PrepareAndLoadMeshData(md, meshVertexArray, meshSize);
+    // En : Uniforms shared across programs live in one uniform buffer that is bound once per frame.
+    // Tr : Programlar arasında paylaşılan uniformlar, her karede bir kez bağlanan tek bir uniform tamponunda tutulur.
+    FrameUniforms frame = {glm::ortho(0.0f, 800.0f, 0.0f, 800.0f)};
+    UniformBuffer *frameUniforms = new UniformBuffer(0, sizeof(FrameUniforms));
+    frameUniforms->Update(&frame, sizeof(frame));
+
+    // En : Normals are generated only if the mesh shader reads them. The root element of the scene may choose the mode.
+    // Tr : Normaller yalnızca mesh gölgelendiricisi onları okuyorsa oluşturulur. Sahnenin kök elemanı modu seçebilir.
+    if (meshShader->UsesAttribute(attributeLocations[(int)VertexAttribute::Normal]))
+        GlobalNormalMode = NormalMode::AngleWeighted;
+
+#ifdef SCENE_H
+    // En : The object matrices of the scene graph stay on their own texture unit, the render queue binds the draw textures to unit 0.
+    // Tr : Sahne grafiğinin nesne matrisleri kendi doku biriminde kalır, çizim kuyruğu çizim dokularını 0. birime bağlar.
+    const GLuint objectMatrixUnit = 1;
+    meshShader->SetUniform("objectMatrices", (int)objectMatrixUnit);
+#endif
+#ifdef MATERIAL_H
+    const GLuint objectMaterialUnit = 2;
+    meshShader->SetUniform("objectMaterials", (int)objectMaterialUnit);
+#endif
+#ifdef PRIMITIVE_H
+    // En : Elements marked procedural are drawn from their parameters by a shader without vertex attributes.
+    // Tr : Prosedürel olarak işaretlenen elemanlar, parametrelerinden köşe niteliği olmayan bir gölgelendirici ile çizilir.
+    Shader *proceduralShader = new Shader("Shaders\\procedural.vs", "Shaders\\fragment.fs");
+    const GLuint primitiveUnit = 3;
+    int primitiveShift = -1;
+    proceduralShader->SetUniform("objectMatrices", (int)objectMatrixUnit);
+    proceduralShader->SetUniform("objectMaterials", (int)objectMaterialUnit);
+    proceduralShader->SetUniform("primitives", (int)primitiveUnit);
+#endif
 
+    // En : The scene is parsed on a worker thread and streamed into the mesh buffers while frames keep being drawn.
+    // Tr : Sahne bir işçi iş parçacığında ayrıştırılır ve kareler çizilmeye devam ederken mesh tamponlarına aktarılır.
+    // En : The CPU copy of the scene is kept only for what is read back. "--picking" keeps the positions, the objects and the indices for the ray queries, object transforms change every attribute in place.
+    // Tr : Sahnenin CPU kopyası yalnızca geri okunanlar için tutulur. "--picking" ışın sorguları için pozisyonları, nesneleri ve indisleri tutar, nesne dönüşümleri her niteliği yerinde değiştirir.
+    unsigned int shadow = 0;
+#ifdef BVH_H
+    for (int i = 1; i < argc; i++)
+        if (std::string(argv[i]) == "--picking")
+            shadow |= 1u << (int)VertexAttribute::Position | 1u << (int)VertexAttribute::Object;
+#endif
 #ifdef OBJECT_H
-    float prevTime = 0, currentTime = 0;
+    shadow = AllVertexAttributes;
+#endif
+    SceneLoader *loader = new SceneLoader("test.xml");
+    MeshStream *meshStream = new MeshStream(shadow);
+    const int meshUploadBudget = 8 << 20;
+    bool loading = true;
+
+#ifdef PAGING_H
+    // En : "--page-budget <MB>" pages the geometry instead of keeping all of it on the GPU. The chunks are written into a page file while the scene is parsed, then the pages around the view are kept resident within the budget.
+    // Tr : "--page-budget <MB>" geometrinin tamamını GPU'da tutmak yerine sayfalar. Sahne ayrıştırılırken parçalar bir sayfa dosyasına yazılır, ardından görünümün çevresindeki sayfalar bütçe içinde yerleşik tutulur.
+    // En : Paged geometry has no CPU copy, so objects and picking are not available.
+    // Tr : Sayfalanan geometrinin CPU kopyası yoktur, bu yüzden nesneler ve seçim kullanılamaz.
+    long long pageBudget = 0;
+    for (int i = 1; i + 1 < argc; i++)
+        if (std::string(argv[i]) == "--page-budget")
+            pageBudget = std::atoll(argv[i + 1]) << 20;
+    PageWriter *pageWriter = pageBudget > 0 ? new PageWriter("test.xml.pages") : nullptr;
+    PagedScene *pagedScene = nullptr;
+#endif
+
+    // En : Every draw is submitted to the render queue, which sorts and merges them once per frame. A frame with more than 256 draws is reported.
+    // Tr : Her çizim, onları her karede bir kez sıralayan ve birleştiren çizim kuyruğuna gönderilir. 256'dan fazla çizimi olan bir kare bildirilir.
+    RenderQueue *renderQueue = new RenderQueue(256);
+
+#ifdef BVH_H
+    // En : With "--picking" the ray query hierarchy is built once the scene is loaded. Pick with the left mouse button.
+    // Tr : "--picking" ile ışın sorgu hiyerarşisi sahne yüklendiğinde oluşturulur. Sol fare tuşu ile seç.
+    BVH *sceneBVH = nullptr;
+    glfwSetMouseButtonCallback(window, MouseButtonCallback);
 #endif
 
 #ifdef TEXT_H
@@ -253,7 +310,7 @@ int main()
 
     Shader *textShader = new Shader("Shaders\\text.vs", "Shaders\\text.fs");
 
-    textShader->SetUniform(std::string("projection").c_str(), glm::ortho(0.0f, 800.0f, 0.0f, 800.0f));
+    textShader->BindUniformBlock("Frame", frameUniforms->GetBinding());
 
     GLenum error = glGetError();
     if (error != GL_NO_ERROR)
@@ -261,51 +318,215 @@ int main()
         std::cout << "Error: " << error << std::endl;
     }
 
-    Text *text = new Text("test", "fonts\\unifont-15.1.05.otf");
-
-    int size;
-    GLuint *textures = text->GetTextures(size);
+    // En : Every text keeps its slot in one shared buffer, a frame uploads only the texts that changed.
+    // Tr : Her metin paylaşılan tek bir tamponda yuvasını tutar, bir kare yalnızca değişen metinleri yükler.
+    TextBuffer *textBuffer = new TextBuffer();
+    textShader->SetUniform("textColor", glm::vec3(1.0f));
 
-    for (int i = 0; i < size; i++)
-    {
-        std::cout << textures[i] << std::endl;
-    }
+    // En : Glyphs are rasterised once as distance fields, so every text size shares them.
+    // Tr : Glifler bir kez uzaklık alanı olarak rasterleştirilir, böylece tüm metin boyutları onları paylaşır.
+    GlobalGlyphMode = GlyphMode::SDF;
+    textShader->SetUniform("distanceField", GlobalGlyphMode == GlyphMode::SDF ? 1 : 0);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    GLuint textVertexArray;
-    int textSize;
-    PrepareTextBuffer({text}, textVertexArray, textSize);
+    Text *text = new Text("test", "fonts\\unifont-15.1.05.otf");
+    text->SetPosition(glm::vec2(10.0f, 10.0f));
+    textBuffer->Add(text);
+
+    // En : The overlay is rebuilt twice a second, so the counters stay readable.
+    // Tr : Sayaçlar okunabilir kalsın diye kaplama saniyede iki kez yeniden oluşturulur.
+    Text *statsText = new Text("", "fonts\\unifont-15.1.05.otf");
+    statsText->SetPosition(glm::vec2(10.0f, 780.0f));
+    textBuffer->Add(statsText);
+    Text *framesText = new Text("", "fonts\\unifont-15.1.05.otf");
+    framesText->SetPosition(glm::vec2(10.0f, 760.0f));
+    textBuffer->Add(framesText);
+    Text *memoryText = new Text("", "fonts\\unifont-15.1.05.otf");
+    memoryText->SetPosition(glm::vec2(10.0f, 740.0f));
+    textBuffer->Add(memoryText);
+    double statsTime = 0;
+    glfwSetKeyCallback(window, KeyCallback);
 
 #endif
 
     while (!glfwWindowShouldClose(window))
     {
+        if (loading)
+            GlobalFrames.RequestRedraw();
+#ifdef ANIMATION_H
+        if (GlobalAnimator.GetTrackCount() > 0)
+            GlobalFrames.RequestRedraw();
+#endif
+#ifdef TEXT_H
+        if (ShowFrameStats && glfwGetTime() - statsTime > 0.5)
+            GlobalFrames.RequestRedraw();
+#endif
+        // En : The timeout wakes the loop up often enough to refresh the counters while nothing else changes.
+        // Tr : Zaman aşımı, başka hiçbir şey değişmezken sayaçları yenileyecek sıklıkta döngüyü uyandırır.
+        if (!GlobalFrames.WaitForFrame(0.5))
+            continue;
+
+        GlobalFrames.BeginFrame();
+        GlobalState.BeginFrame();
 
         glClear(GL_COLOR_BUFFER_BIT);
+        frameUniforms->Bind();
+
+        if (loading)
+        {
+            // En : Take the finished chunks and upload a bounded amount of them per frame.
+            // Tr : Biten parçaları al ve her karede sınırlı bir miktarını yükle.
+            MeshChunk chunk;
+            while (loader->Poll(chunk))
+            {
+#ifdef PAGING_H
+                if (pageWriter)
+                    pageWriter->Write(chunk);
+                else
+#endif
+                    meshStream->Push(chunk);
+#ifdef SCENE_H
+                GlobalScene.Append(chunk);
+#endif
+#ifdef MATERIAL_H
+                GlobalMaterials.Append(chunk);
+#endif
+#ifdef PRIMITIVE_H
+                GlobalPrimitives.Append(chunk);
+#endif
+#ifdef ANIMATION_H
+                GlobalAnimator.Append(chunk);
+#endif
+#ifdef OBJECT_H
+                GlobalStore = &meshStream->GetStore();
+#ifdef PAGING_H
+                if (pageWriter)
+                    continue;
+#endif
+                for (int i = 0; i < (int)chunk.objects.size(); i++)
+                    (new Object(chunk.objects[i].x, chunk.objects[i].y))->SetIndexRange(chunk.objectIndices[i].x, chunk.objectIndices[i].y);
+#endif
+            }
+            meshStream->Update(meshUploadBudget);
+
+            std::string title = "ShapeIt - Loading " + std::to_string((int)(loader->GetProgress() * 100)) + "%";
+            if (loader->IsFinished() && meshStream->IsIdle())
+            {
+                loading = false;
+                title = "ShapeIt";
+#ifdef PAGING_H
+                if (pageWriter)
+                {
+                    if (pageWriter->Finish())
+                        pagedScene = new PagedScene("test.xml.pages", pageBudget);
+                    std::cout << "Pages: " << pageWriter->GetPageCount() << std::endl;
+                    delete pageWriter;
+                    pageWriter = nullptr;
+                }
+#endif
+                std::cout << FormatMemoryReport(GlobalMemory, true) << std::endl;
+#ifdef BVH_H
+                if (meshStream->GetStore().Has(VertexAttribute::Position))
+                {
+                    sceneBVH = new BVH();
+                    sceneBVH->Build(&meshStream->GetStore().positions[0].x, 3, meshStream->GetIndices(), meshStream->GetStore().objects.data());
+                    glfwSetWindowUserPointer(window, sceneBVH);
+                }
+#endif
+            }
+            glfwSetWindowTitle(window, title.c_str());
+        }
+
+#ifdef SCENE_H
+        // En : Changed groups are propagated, animated objects are evaluated on every core and the object matrices are uploaded in one batch before any draw.
+        // Tr : Değişen gruplar yayılır, animasyonlu nesneler her çekirdekte değerlendirilir ve nesne matrisleri herhangi bir çizimden önce tek seferde yüklenir.
+        GlobalScene.Update();
+#ifdef ANIMATION_H
+        GlobalAnimator.Update(GlobalScene, glfwGetTime());
+#endif
+        GlobalScene.Upload();
+        GlobalScene.Bind(objectMatrixUnit);
+#endif
+#ifdef MATERIAL_H
+        GlobalMaterials.Upload();
+        GlobalMaterials.Bind(objectMaterialUnit);
+#endif
 
 #ifdef OBJECT_H
-        currentTime = glfwGetTime();
+        if (!loading)
+            meshStream->Rewrite();
+#ifdef BVH_H
+        if (sceneBVH)
+            sceneBVH->Refit();
+#endif
+#endif
+
+#ifdef PAGING_H
+        if (pagedScene)
+        {
+            // En : The mesh pass draws the object matrices without a projection, so pages are culled in the same space.
+            // Tr : Mesh geçişi nesne matrislerini izdüşüm olmadan çizer, bu yüzden sayfalar aynı uzayda ayıklanır.
+            pagedScene->Update(glm::mat4(1.0f), meshUploadBudget);
+            pagedScene->Submit(*renderQueue, meshShader->GetProgram());
+            if (!pagedScene->IsIdle())
+                GlobalFrames.RequestRedraw();
+        }
+        else
+#endif
+#ifdef OBJECT_H
+        // En : One packet per object. Objects sharing a shader are merged back into a single draw by the queue.
+        // Tr : Nesne başına bir paket. Aynı gölgelendiriciyi paylaşan nesneler kuyruk tarafından tek bir çizimde yeniden birleştirilir.
         for (Object *o : GlobalObejcts)
         {
-            // o->Rotate(glm::vec3(0.35f, 0.35f, 0.35f) * (currentTime - prevTime) * 20.0f);
+            if (o->GetIndexEnd() > meshStream->GetIndexCount())
+                continue;
+            Shader *shader = o->GetShader() ? o->GetShader() : meshShader;
+            renderQueue->Submit(RenderPass::Opaque, shader->GetProgram(), meshStream->GetVertexArray(), 0, GL_TRIANGLES, o->GetIndexBegin(), o->GetIndexEnd() - o->GetIndexBegin(), true);
         }
-        glBufferData(GL_ARRAY_BUFFER, GlobalDataElementSize * sizeof(float), GlobalData, GL_STATIC_DRAW);
-        prevTime = currentTime;
+#else
+        renderQueue->Submit(RenderPass::Opaque, meshShader->GetProgram(), meshStream->GetVertexArray(), 0, GL_TRIANGLES, 0, meshStream->GetIndexCount(), true);
 #endif
 
-        meshShader->Use();
-        glBindVertexArray(meshVertexArray);
-        glDrawElements(GL_TRIANGLES, meshSize, GL_UNSIGNED_INT, 0);
-
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+#ifdef PRIMITIVE_H
+        GlobalPrimitives.Upload();
+        GlobalPrimitives.Bind(primitiveUnit);
+        if (primitiveShift != GlobalPrimitives.GetShift())
+        {
+            primitiveShift = GlobalPrimitives.GetShift();
+            proceduralShader->SetUniform("primitiveShift", primitiveShift);
+        }
+        GlobalPrimitives.Submit(*renderQueue, proceduralShader->GetProgram());
+#endif
 
 #ifdef TEXT_H
-        textShader->Use();
-        glBindVertexArray(textVertexArray);
-        glDrawArrays(GL_TRIANGLES, 0, textSize * 24);
+        if (!ShowFrameStats)
+        {
+            statsText->SetContent("");
+            framesText->SetContent("");
+            memoryText->SetContent("");
+        }
+        else if (glfwGetTime() - statsTime > 0.5)
+        {
+            statsTime = glfwGetTime();
+            statsText->SetContent(FormatFrameStats(GlobalState.GetFrameStats()).c_str());
+            framesText->SetContent(FormatFrameHistogram(GlobalFrames.GetHistogram()).c_str());
+            memoryText->SetContent(FormatMemoryReport(GlobalMemory).c_str());
+        }
+        textBuffer->Update();
+        textBuffer->Submit(*renderQueue, textShader->GetProgram());
 #endif
+
+        renderQueue->Execute();
+
+        glfwSwapBuffers(window);
+        GlobalFrames.EndFrame();
     }
 
+    std::cout << FormatFrameHistogram(GlobalFrames.GetHistogram(), true) << std::endl;
+    std::cout << "Skipped wake-ups: " << GlobalFrames.GetSkippedFrames() << std::endl;
+    std::cout << FormatMemoryReport(GlobalMemory, true) << std::endl;
+
 #ifdef TEXT_H
     FT_Done_FreeType(ft);
 #endif
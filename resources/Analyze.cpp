@@ -1,6 +1,10 @@
 // En : Definitions of Analyze.h file.
 // Tr : Analyze.h dosyasının tanımlamaları.
 #include "Analyze.h"
+#include "Import.h"
+#include "Triangulate.h"
+#include "Surface.h"
+#include "Jobs.h"
 #include <stack>
 #include <iostream>
 #include <math.h>
@@ -9,6 +13,7 @@
 #include <glm/gtx/rotate_vector.hpp>
 #include <sstream>
 #include <numeric>
+#include <climits>
 #ifdef OBJECT_H
 #include "Object.h"
 #endif
@@ -24,7 +29,8 @@ const std::string definedTags[] =
         "cone",
         "array",
         "prism",
-        "import"};
+        "import",
+        "surface"};
 const std::map<std::string, std::function<glm::vec3 *(tinyxml2::XMLElement *, int &)>> positionalHandlers =
     {
         {"box", BoxPositionalData},
@@ -32,7 +38,9 @@ const std::map<std::string, std::function<glm::vec3 *(tinyxml2::XMLElement *, in
         {"cylinder", CylinderPositionalData},
         {"cone", ConePositionalData},
         {"array", ArrayPositionalData},
-        {"prism", PrismPositionalData}};
+        {"prism", PrismPositionalData},
+        {"import", ImportPositionalData},
+        {"surface", SurfacePositionalData}};
 const std::map<std::string, std::function<int *(tinyxml2::XMLElement *, int &)>> indexHandlers =
     {
         {"box", BoxIndexData},
@@ -40,34 +48,152 @@ const std::map<std::string, std::function<int *(tinyxml2::XMLElement *, int &)>>
         {"cylinder", CylinderIndexData},
         {"cone", ConeIndexData},
         {"array", ArrayIndexData},
-        {"prism", PrismIndexData}};
+        {"prism", PrismIndexData},
+        {"import", ImportIndexData},
+        {"surface", SurfaceIndexData}};
+const std::map<std::string, std::function<glm::vec3 *(tinyxml2::XMLElement *, int &)>> normalHandlers =
+    {
+        {"circle", CircleNormalData},
+        {"cylinder", CylinderNormalData},
+        {"cone", ConeNormalData},
+        {"surface", SurfaceNormalData}};
+const std::map<std::string, std::function<glm::vec2 *(tinyxml2::XMLElement *, int &)>> uvHandlers =
+    {
+        {"surface", SurfaceUVData}};
 const std::string elementTag[] =
     {
         "vertex",
         "edge",
         "face",
         "index"};
+// En : The surface read by the positional handler, reused by the other handlers of the same element, so that its expressions are compiled once. The grid positions are kept only if analytic normals will be asked for.
+// Tr : Konum işleyicisi tarafından okunan yüzey, aynı elemanın diğer işleyicileri tarafından yeniden kullanılır, böylece ifadeleri bir kez derlenir. Izgara pozisyonları yalnızca analitik normaller istenecekse tutulur.
+struct SurfaceCache
+{
+    tinyxml2::XMLElement *element = nullptr;
+    bool valid = false;
+    ParametricSurface surface;
+    std::vector<glm::vec3> positions;
+};
+thread_local SurfaceCache surfaceCache;
 
-void AnalyzeTag(tinyxml2::XMLElement *element, MeshData &data)
+void AnalyzeTag(tinyxml2::XMLElement *element, VertexStreams &data)
 {
-    // En : Data definitons.
-    // Tr : Veri tanımları.
-    data = MeshData();
-    data["position"] = std::vector<glm::vec3>();
-    data["index"] = std::vector<int>();
-    data["color"] = std::vector<glm::vec3>();
+    // En : The whole scene is collected as a single chunk.
+    // Tr : Tüm sahne tek bir parça olarak toplanır.
+    AnalyzeTag(element, INT_MAX, [&](MeshChunk &chunk)
+               {
+                   data = std::move(chunk.data);
+#ifdef SCENE_H
+                   GlobalScene.Append(chunk);
+#endif
+#ifdef MATERIAL_H
+                   GlobalMaterials.Append(chunk);
+#endif
+#ifdef PRIMITIVE_H
+                   GlobalPrimitives.Append(chunk);
+#endif
+#ifdef ANIMATION_H
+                   GlobalAnimator.Append(chunk);
+#endif
+#ifdef OBJECT_H
+                   for (int i = 0; i < (int)chunk.objects.size(); i++)
+                       (new Object(chunk.objects[i].x, chunk.objects[i].y))->SetIndexRange(chunk.objectIndices[i].x, chunk.objectIndices[i].y);
+#endif
+               });
+}
 
-    std::vector<glm::vec3> &position = std::get<std::vector<glm::vec3>>(data["position"]);
-    std::vector<int> &index = std::get<std::vector<int>>(data["index"]);
-    std::vector<glm::vec3> &color = std::get<std::vector<glm::vec3>>(data["color"]);
+bool ContainsTag(tinyxml2::XMLElement *element, const std::string &name)
+{
+    for (tinyxml2::XMLElement *sub = element->FirstChildElement(); sub != nullptr; sub = sub->NextSiblingElement())
+    {
+        std::string tag = sub->Name();
+        std::transform(tag.begin(), tag.end(), tag.begin(), tolower);
+        if (tag == name || (std::find(std::begin(definedTags), std::end(definedTags), tag) == std::end(definedTags) && ContainsTag(sub, name)))
+            return true;
+    }
+    return false;
+}
 
-    // En : Stack for the depth first search.
-    // Tr : Derinlik öncelikli arama için yığın.
-    std::stack<tinyxml2::XMLElement *> stack;
-    stack.push(element);
+// En : Center of the vertices the meshed form of a primitive would have, the pivot of its rotations.
+// Tr : Bir ilkelin ağ biçiminin sahip olacağı köşelerin merkezi, dönmelerinin pivotu.
+glm::vec3 PrimitiveCenter(const Primitive &primitive)
+{
+    // En : The rings and the cap centers of circles and cylinders cancel out. A cone has its ring and bottom center below and only the apex above.
+    // Tr : Daire ve silindirlerin halkaları ve kapak merkezleri birbirini götürür. Bir koninin halkası ve alt merkezi aşağıda, yalnızca tepesi yukarıdadır.
+    if (primitive.type != PrimitiveType::Cone)
+        return glm::vec3(0.0f);
+    return glm::vec3(0.0f, -primitive.height / 2 * primitive.resolution / (primitive.resolution + 2), 0.0f);
+}
+
+bool ContainsAttribute(tinyxml2::XMLElement *element, const char *name)
+{
+    for (tinyxml2::XMLElement *sub = element->FirstChildElement(); sub != nullptr; sub = sub->NextSiblingElement())
+        if (sub->Attribute(name) || ContainsAttribute(sub, name))
+            return true;
+    return false;
+}
+
+int CountTags(tinyxml2::XMLElement *element)
+{
+    int count = 0;
+    for (tinyxml2::XMLElement *sub = element->FirstChildElement(); sub != nullptr; sub = sub->NextSiblingElement())
+    {
+        std::string tag = sub->Name();
+        std::transform(tag.begin(), tag.end(), tag.begin(), tolower);
+        if (std::find(std::begin(definedTags), std::end(definedTags), tag) != std::end(definedTags))
+            count++;
+        else
+            count += CountTags(sub);
+    }
+    return count;
+}
+
+void AnalyzeTag(tinyxml2::XMLElement *element, int chunkSize, const std::function<void(MeshChunk &)> &flush)
+{
+    // En : Data definitons. The vectors are reset after every flushed chunk.
+    // Tr : Veri tanımları. Vektörler her gönderilen parçadan sonra sıfırlanır.
+    MeshChunk chunk;
+    AlignedVector<glm::vec3> *position, *color;
+    std::vector<int> *index;
+    AlignedVector<int> *object;
+    int vertexBase = 0, indexBase = 0, objectCount = 0, groupCount = 0;
+    // En : Every chunk must carry the same streams, so texture coordinates are added to all of them if any element has its own.
+    // Tr : Her parça aynı akışları taşımalıdır, bu yüzden herhangi bir eleman kendi doku koordinatlarına sahipse hepsine eklenir.
+    bool uvs = ContainsTag(element, "surface");
+    // En : Plain colors go into the materials, the color stream is only needed for gradients.
+    // Tr : Düz renkler malzemelere gider, renk akışına yalnızca gradyanlar için ihtiyaç duyulur.
+    bool gradients = ContainsAttribute(element, "colorExpr");
+    bool procedural = ElementProcedural(element, false);
+    auto reset = [&]()
+    {
+        chunk = MeshChunk();
+        chunk.vertexBase = vertexBase;
+        chunk.indexBase = indexBase;
+        chunk.data.Enable(VertexAttribute::Position);
+        if (gradients)
+            chunk.data.Enable(VertexAttribute::Color);
+        chunk.data.Enable(VertexAttribute::Object);
+        if (GlobalNormalMode != NormalMode::None)
+            chunk.data.Enable(VertexAttribute::Normal);
+        if (uvs)
+            chunk.data.Enable(VertexAttribute::UV);
+        position = &chunk.data.positions;
+        index = &chunk.data.indices;
+        color = &chunk.data.colors;
+        object = &chunk.data.objects;
+    };
+    reset();
+
+    // En : Stack for the depth first search. Every container is a group, the root element is the first one.
+    // Tr : Derinlik öncelikli arama için yığın. Her kapsayıcı bir gruptur, kök eleman ilkidir.
+    std::stack<std::pair<tinyxml2::XMLElement *, int>> stack;
+    chunk.groups.push_back(AnalyzeGroup(element, -1));
+    stack.push({element, groupCount++});
     while (stack.size())
     {
-        tinyxml2::XMLElement *current = stack.top();
+        tinyxml2::XMLElement *current = stack.top().first;
+        int group = stack.top().second;
         stack.pop();
         for (tinyxml2::XMLElement *sub = current->FirstChildElement(); sub != nullptr; sub = sub->NextSiblingElement())
         {
@@ -80,50 +206,252 @@ void AnalyzeTag(tinyxml2::XMLElement *element, MeshData &data)
             // Tr : Eğer etiket önceden tanımlanmışsa, veriyi çıkar aksi halde yığına ekle.
             if (std::find(std::begin(definedTags), std::end(definedTags), tag) != std::end(definedTags))
             {
-                // En : Get the positional data and apply the transforms. If object model is defined, create the object.
-                // Tr : Pozisyon verilerini al ve dönüşümleri uygula. Eğer nesne modeli tanımlanmışsa, nesneyi oluştur.
+                // En : A procedural element only records its parameters and an object with empty ranges, no vertices are generated.
+                // Tr : Prosedürel bir eleman yalnızca parametrelerini ve boş aralıklı bir nesneyi kaydeder, köşe oluşturulmaz.
+                Primitive primitive;
+                if (ElementProcedural(sub, procedural) && ReadPrimitive(sub, tag, primitive))
+                {
+                    int begin = vertexBase + position->size(), indexBegin = indexBase + index->size();
+                    primitive.object = objectCount;
+                    chunk.primitives.push_back(primitive);
+                    chunk.objects.push_back(glm::ivec2(begin, begin));
+                    chunk.objectIndices.push_back(glm::ivec2(indexBegin, indexBegin));
+                    chunk.objectGroups.push_back(group);
+                    chunk.materials.push_back({glm::vec4(ElementColor(sub), 1.0f)});
+                    chunk.elementCount++;
+                    AnimationData animation;
+                    if (AnalyzeAnimation(sub, animation))
+                    {
+                        animation.object = objectCount;
+                        animation.pivot = glm::vec3(primitive.transform * glm::vec4(PrimitiveCenter(primitive), 1.0f));
+                        chunk.animations.push_back(std::move(animation));
+                    }
+                    objectCount++;
+                    continue;
+                }
+
+                // En : Get the positional data and apply the transforms. Record the element, so that an object can be created for it.
+                // Tr : Pozisyon verilerini al ve dönüşümleri uygula. Elemanı kaydet, böylece onun için bir nesne oluşturulabilir.
 
                 // En : Step 1 : Assign the needed variables.
                 // Tr : Adım 1 : Gerekli değişkenleri ata.
-                int size;
-#ifdef OBJECT_H
-                int begin = position.size();
-#endif
-                int lastIndex = index.size() ? *std::max_element(index.begin(), index.end()) + 1 : 0;
+                int size, indexSize;
+                int begin = vertexBase + position->size();
+                int indexBegin = indexBase + index->size();
+                int lastIndex = begin;
 
-                // En : Step 2 : Get the positional data and apply the transforms.
-                // Tr : Adım 2 : Pozisyon verilerini al ve dönüşümleri uygula.
-                glm::vec3 *_position = positionalHandlers.at(tag)(sub, size);
-                _position = ApplyTranforms(sub, _position, size);
-                for (int i = 0; i < size; i++)
-                    position.push_back(_position[i]);
+                // En : Step 2 : Get the positional data, apply the transforms and get the index data.
+                // Tr : Adım 2 : Pozisyon verilerini al, dönüşümleri uygula ve index verilerini al.
+                glm::vec3 *_source = positionalHandlers.at(tag)(sub, size);
+                glm::vec3 *_position = ApplyTranforms(sub, _source, size);
+                if (_position != _source)
+                    delete[] _source;
+                int *_index = indexHandlers.at(tag)(sub, indexSize);
+                glm::vec2 *_uv = nullptr;
+                if (uvs)
+                {
+                    int uvSize;
+                    _uv = uvHandlers.find(tag) != uvHandlers.end() ? uvHandlers.at(tag)(sub, uvSize) : new glm::vec2[size]();
+                }
 
-#ifdef OBJECT_H
-                // En : Optional Step : Create the an object.
-                // Tr : İsteğe bağlı Adım : Bir nesne oluştur.
-                int end = position.size();
-                new Object(begin, end);
-#endif
-                // En : Step 3 : Get the color data.
-                // Tr : Adım 3 : Renk verilerini al.
-                glm::vec3 *_color = AddColorData(size, sub);
-                for (int i = 0; i < size; i++)
-                    color.push_back(_color[i]);
-
-                // En : Step 4 : Get the index data.
-                // Tr : Adım 4 : Index verilerini al.
-                int *_index = indexHandlers.at(tag)(sub, size);
-                for (int i = 0; i < size; i++)
-                    index.push_back(_index[i] + lastIndex);
+                // En : Step 3 : Get the normal data if it is needed. Analytic normals are preferred unless the element is flat.
+                // Tr : Adım 3 : Gerekiyorsa normal verilerini al. Eleman düz değilse analitik normaller tercih edilir.
+                NormalMode mode = ElementNormalMode(sub);
+                if (mode != NormalMode::None)
+                {
+                    glm::vec3 *_normal;
+                    if (mode == NormalMode::Flat)
+                    {
+                        glm::vec3 *_welded = _position;
+                        int *_weldedIndex = _index;
+                        if (_uv)
+                        {
+                            glm::vec2 *_weldedUV = _uv;
+                            _uv = new glm::vec2[indexSize];
+                            for (int i = 0; i < indexSize; i++)
+                                _uv[i] = _weldedUV[_weldedIndex[i]];
+                            delete[] _weldedUV;
+                        }
+                        UnweldTriangles(_position, size, _index, indexSize);
+                        delete[] _welded;
+                        delete[] _weldedIndex;
+                        _normal = GenerateNormals(_position, size, _index, indexSize, mode);
+                    }
+                    else if (normalHandlers.find(tag) != normalHandlers.end())
+                    {
+                        int normalSize;
+                        glm::vec3 *_analytic = normalHandlers.at(tag)(sub, normalSize);
+                        _normal = ApplyNormalTransforms(sub, _analytic, normalSize);
+                        delete[] _analytic;
+                    }
+                    else
+                        _normal = GenerateNormals(_position, size, _index, indexSize, mode);
+                    chunk.data.normals.insert(chunk.data.normals.end(), _normal, _normal + size);
+                    delete[] _normal;
+                }
+
+                position->insert(position->end(), _position, _position + size);
+                if (_uv)
+                {
+                    chunk.data.uvs.insert(chunk.data.uvs.end(), _uv, _uv + size);
+                    delete[] _uv;
+                }
+
+                // En : Step 4 : Record the vertex range of the element, an object is created for it by the consumer.
+                // Tr : Adım 4 : Elemanın köşe aralığını kaydet, bunun için nesne tüketici tarafından oluşturulur.
+                chunk.objects.push_back(glm::ivec2(begin, vertexBase + position->size()));
+                chunk.objectGroups.push_back(group);
+                chunk.elementCount++;
+                AnimationData animation;
+                if (AnalyzeAnimation(sub, animation))
+                {
+                    animation.object = objectCount;
+                    animation.pivot = std::accumulate(_position, _position + size, glm::vec3(0, 0, 0)) / (float)std::max(size, 1);
+                    chunk.animations.push_back(std::move(animation));
+                }
+                object->insert(object->end(), size, objectCount++);
+
+                // En : Step 5 : Get the material and the color data. A colorExpr attribute is evaluated over the transformed positions under a white material, the color attribute is the fallback and becomes the material color over white vertices.
+                // Tr : Adım 5 : Malzeme ve renk verilerini al. colorExpr niteliği beyaz bir malzeme altında dönüştürülmüş pozisyonlar üzerinde değerlendirilir, color niteliği yedektir ve beyaz köşeler üzerinde malzeme rengi olur.
+                glm::vec3 *_color = nullptr;
+                if (sub->Attribute("colorExpr"))
+                {
+                    ColorExpression expression;
+                    if (expression.Compile(sub->Attribute("colorExpr")))
+                        _color = AddParametricColorData(size, expression, _position);
+                    else
+                        std::cout << "Error: invalid colorExpr value : " << sub->Attribute("colorExpr") << " (" << expression.GetError() << "). Accepted as the color attribute." << std::endl;
+                }
+                chunk.materials.push_back({glm::vec4(_color ? glm::vec3(1.0f) : ElementColor(sub), 1.0f)});
+                if (gradients)
+                {
+                    if (!_color)
+                        _color = AddColorData(size, glm::vec3(1.0f));
+                    color->insert(color->end(), _color, _color + size);
+                }
+
+                // En : Step 6 : Add the index data.
+                // Tr : Adım 6 : Index verilerini ekle.
+                for (int i = 0; i < indexSize; i++)
+                    index->push_back(_index[i] + lastIndex);
+                chunk.objectIndices.push_back(glm::ivec2(indexBegin, indexBase + index->size()));
+                delete[] _position;
+                delete[] _index;
+                delete[] _color;
+
+                // En : Step 7 : Hand the chunk over once it is large enough.
+                // Tr : Adım 7 : Parça yeterince büyüdüğünde teslim et.
+                if ((int)position->size() >= chunkSize)
+                {
+                    vertexBase += position->size();
+                    indexBase += index->size();
+                    flush(chunk);
+                    reset();
+                }
             }
             else
             {
-                // En : If the tag is not predefined, push to the stack.
-                // Tr : Eğer etiket önceden tanımlanmamışsa, yığına ekle.
-                stack.push(sub);
+                // En : If the tag is not predefined, open a group for it and push to the stack.
+                // Tr : Eğer etiket önceden tanımlanmamışsa, onun için bir grup aç ve yığına ekle.
+                chunk.groups.push_back(AnalyzeGroup(sub, group));
+                stack.push({sub, groupCount++});
             }
         }
     }
+    flush(chunk);
+}
+
+SceneGroup AnalyzeGroup(tinyxml2::XMLElement *element, int parent)
+{
+    SceneGroup group = {parent, glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f)};
+    float values[3];
+    if (element->Attribute("offset"))
+    {
+        if (ParseFloats(element->Attribute("offset"), values, 3))
+            group.offset = glm::vec3(values[0], values[1], values[2]);
+        else
+            std::cout << "Error: invalid offset value : " << element->Attribute("offset") << ". Accepted as (0,0,0)." << std::endl;
+    }
+    // En : Rotation is given in radians like on the elements, and kept in degrees like on the objects.
+    // Tr : Dönme elemanlarda olduğu gibi radyan cinsinden verilir ve nesnelerde olduğu gibi derece cinsinden tutulur.
+    if (element->Attribute("rotation"))
+    {
+        if (ParseFloats(element->Attribute("rotation"), values, 3))
+            group.rotation = glm::vec3(values[0], values[1], values[2]) * (180.0f / PI);
+        else
+            std::cout << "Error: invalid rotation value : " << element->Attribute("rotation") << ". Accepted as (0,0,0)." << std::endl;
+    }
+    if (element->Attribute("scale"))
+    {
+        if (ParseFloats(element->Attribute("scale"), values, 3))
+            group.scale = glm::vec3(values[0], values[1], values[2]);
+        else
+            std::cout << "Error: invalid scale value : " << element->Attribute("scale") << ". Accepted as (1,1,1)." << std::endl;
+    }
+    return group;
+}
+
+bool AnalyzeAnimation(tinyxml2::XMLElement *element, AnimationData &animation)
+{
+    animation = {-1, glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.0f), 1.0f, 0.0f, {}};
+    float values[3];
+    bool animated = false;
+    // En : Angles are given in radians like the rotation attribute.
+    // Tr : Açılar rotation niteliği gibi radyan cinsinden verilir.
+    if (element->Attribute("spin"))
+    {
+        if (ParseFloats(element->Attribute("spin"), values, 3))
+        {
+            animation.spin = glm::vec3(values[0], values[1], values[2]) * (180.0f / PI);
+            animated = true;
+        }
+        else
+            std::cout << "Error: invalid spin value : " << element->Attribute("spin") << ". Accepted as (0,0,0)." << std::endl;
+    }
+    if (element->Attribute("oscillation"))
+    {
+        if (ParseFloats(element->Attribute("oscillation"), values, 3))
+        {
+            animation.amplitude = glm::vec3(values[0], values[1], values[2]);
+            animated = true;
+        }
+        else
+            std::cout << "Error: invalid oscillation value : " << element->Attribute("oscillation") << ". Accepted as (0,0,0)." << std::endl;
+    }
+    if (element->Attribute("frequency") && !ParseFloats(element->Attribute("frequency"), &animation.frequency, 1))
+    {
+        std::cout << "Error: invalid frequency value : " << element->Attribute("frequency") << ". Accepted as 1." << std::endl;
+        animation.frequency = 1.0f;
+    }
+    if (element->Attribute("phase") && !ParseFloats(element->Attribute("phase"), &animation.phase, 1))
+    {
+        std::cout << "Error: invalid phase value : " << element->Attribute("phase") << ". Accepted as 0." << std::endl;
+        animation.phase = 0.0f;
+    }
+
+    for (tinyxml2::XMLElement *sub = element->FirstChildElement(); sub != nullptr; sub = sub->NextSiblingElement())
+    {
+        std::string tag = sub->Name();
+        std::transform(tag.begin(), tag.end(), tag.begin(), tolower);
+        if (tag != "keyframe")
+            continue;
+        Keyframe keyframe = {0.0f, glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(1.0f)};
+        if (!sub->Attribute("time") || !ParseFloats(sub->Attribute("time"), &keyframe.time, 1))
+        {
+            std::cout << "Error: keyframe without a valid time is skipped." << std::endl;
+            continue;
+        }
+        if (sub->Attribute("offset") && ParseFloats(sub->Attribute("offset"), values, 3))
+            keyframe.offset = glm::vec3(values[0], values[1], values[2]);
+        if (sub->Attribute("rotation") && ParseFloats(sub->Attribute("rotation"), values, 3))
+            keyframe.rotation = glm::vec3(values[0], values[1], values[2]) * (180.0f / PI);
+        if (sub->Attribute("scale") && ParseFloats(sub->Attribute("scale"), values, 3))
+            keyframe.scale = glm::vec3(values[0], values[1], values[2]);
+        animation.keyframes.push_back(keyframe);
+    }
+    std::sort(animation.keyframes.begin(), animation.keyframes.end(), [](const Keyframe &a, const Keyframe &b)
+              { return a.time < b.time; });
+    return animated || !animation.keyframes.empty();
 }
 
 glm::vec3 *BoxPositionalData(tinyxml2::XMLElement *element, int &size)
@@ -174,13 +502,16 @@ glm::vec3 *CirclePositionalData(tinyxml2::XMLElement *element, int &size)
         {
             std::cout << "Error: invalid resolution value : " << element->Attribute("resolution") << std::endl;
         }
-    glm::vec3 *position = new glm::vec3[resolution];
+    glm::vec3 *position = new glm::vec3[resolution + 1];
     for (int i = 0; i < resolution; i++)
     {
         float angle = 2 * PI * i / resolution;
         position[i] = glm::vec3(radius * cos(angle), 0, radius * sin(angle));
     }
-    size = resolution;
+    // En : The center vertex referenced by CircleIndexData.
+    // Tr : CircleIndexData tarafından kullanılan merkez köşe.
+    position[resolution] = glm::vec3(0, 0, 0);
+    size = resolution + 1;
     return position;
 }
 
@@ -314,12 +645,15 @@ glm::vec3 *ArrayPositionalData(tinyxml2::XMLElement *element, int &size)
         }
     }
     size = position.size();
-    glm::vec3 *positionArray = position.data();
+    glm::vec3 *positionArray = new glm::vec3[size];
+    std::copy(position.begin(), position.end(), positionArray);
     return positionArray;
 }
 
 glm::vec3 *PrismPositionalData(tinyxml2::XMLElement *element, int &size)
 {
+    // En : Bottom cap, top cap, then four vertices per edge for the walls, so that the walls do not share normals with the caps.
+    // Tr : Alt kapak, üst kapak, sonra duvarlar için kenar başına dört köşe, böylece duvarlar kapaklarla normal paylaşmaz.
     float height = 1.0f;
     if (element->Attribute("height"))
         try
@@ -330,51 +664,327 @@ glm::vec3 *PrismPositionalData(tinyxml2::XMLElement *element, int &size)
         {
             std::cout << "Error: invalid height value : " << element->Attribute("height") << std::endl;
         }
-    std::vector<glm::vec3> position;
-    for (tinyxml2::XMLElement *sub = element->FirstChildElement(); element != element->LastChildElement(); sub = element->NextSiblingElement())
+    std::vector<glm::vec3> ring;
+    std::vector<int> holes;
+    PrismRings(element, ring, holes);
+    int count = ring.size();
+    size = count * 6;
+    glm::vec3 *position = new glm::vec3[size];
+    glm::vec3 up = glm::vec3(0, height, 0);
+    for (int i = 0; i < count; i++)
+    {
+        position[i] = ring[i];
+        position[count + i] = ring[i] + up;
+    }
+    holes.push_back(count);
+    for (int r = 0, begin = 0; r < (int)holes.size(); begin = holes[r++])
+        for (int i = begin; i < holes[r]; i++)
+        {
+            int next = i + 1 < holes[r] ? i + 1 : begin;
+            glm::vec3 *wall = position + count * 2 + i * 4;
+            wall[0] = ring[i];
+            wall[1] = ring[next];
+            wall[2] = ring[next] + up;
+            wall[3] = ring[i] + up;
+        }
+    return position;
+}
+
+void PrismRings(tinyxml2::XMLElement *element, std::vector<glm::vec3> &ring, std::vector<int> &holes, bool report)
+{
+    // En : The outer ring is made counter clockwise and the holes clockwise seen from below, so the caps and the walls can be wound by a single rule.
+    // Tr : Dış halka alttan bakıldığında saat yönü tersine, delikler saat yönüne çevrilir, böylece kapaklar ve duvarlar tek bir kuralla sarılabilir.
+    auto readRing = [&](tinyxml2::XMLElement *parent, bool outer)
+    {
+        int begin = ring.size();
+        for (tinyxml2::XMLElement *sub = parent->FirstChildElement(); sub != nullptr; sub = sub->NextSiblingElement())
+        {
+            std::string tag = sub->Name();
+            std::transform(tag.begin(), tag.end(), tag.begin(), tolower);
+            if (tag != "vertex")
+                continue;
+            glm::vec3 v = glm::vec3(0.0f);
+            const char *names[] = {"x", "y", "z"};
+            for (int axis = 0; axis < 3; axis++)
+                if (sub->Attribute(names[axis]))
+                    try
+                    {
+                        v[axis] = std::stof(sub->Attribute(names[axis]));
+                    }
+                    catch (const std::exception &e)
+                    {
+                        if (report)
+                            std::cout << "Error: invalid " << names[axis] << " value : " << sub->Attribute(names[axis]) << std::endl;
+                    }
+            ring.push_back(v);
+        }
+        if ((int)ring.size() - begin < 3)
+        {
+            if (report && ring.size() != (size_t)begin)
+                std::cout << "Error: prism " << (outer ? "outline" : "hole") << " needs at least 3 vertices." << std::endl;
+            ring.resize(begin);
+            return;
+        }
+        std::vector<glm::vec2> plane;
+        for (int i = begin; i < (int)ring.size(); i++)
+            plane.push_back(glm::vec2(ring[i].x, ring[i].z));
+        if ((SignedArea(plane, 0, plane.size()) > 0) != outer)
+            std::reverse(ring.begin() + begin, ring.end());
+        if (!outer)
+            holes.push_back(begin);
+    };
+    readRing(element, true);
+    if (ring.empty())
+        return;
+    for (tinyxml2::XMLElement *sub = element->FirstChildElement(); sub != nullptr; sub = sub->NextSiblingElement())
     {
         std::string tag = sub->Name();
         std::transform(tag.begin(), tag.end(), tag.begin(), tolower);
-        if (tag == "vertex")
+        if (tag == "hole")
+            readRing(sub, false);
+    }
+}
+
+glm::vec3 *ImportPositionalData(tinyxml2::XMLElement *element, int &size)
+{
+    // En : The file is parsed once and shared, every element gets its own copy to transform. The path is relative to the working directory.
+    // Tr : Dosya bir kez ayrıştırılır ve paylaşılır, her eleman dönüştürmek için kendi kopyasını alır. Yol çalışma dizinine görelidir.
+    size = 0;
+    if (!element->Attribute("src"))
+    {
+        std::cout << "Error: import without src attribute." << std::endl;
+        return new glm::vec3[0];
+    }
+    std::shared_ptr<const ImportedMesh> mesh = ImportMesh(element->Attribute("src"));
+    if (!mesh)
+        return new glm::vec3[0];
+    size = mesh->positions.size();
+    glm::vec3 *positionArray = new glm::vec3[size];
+    std::copy(mesh->positions.begin(), mesh->positions.end(), positionArray);
+    return positionArray;
+}
+
+bool ReadSurface(tinyxml2::XMLElement *element, ParametricSurface &surface, bool report)
+{
+    auto parse = [&](const char *name, float &value)
+    {
+        if (element->Attribute(name))
+            try
+            {
+                value = std::stof(element->Attribute(name));
+            }
+            catch (const std::exception &e)
+            {
+                if (report)
+                    std::cout << "Error: invalid " << name << " value : " << element->Attribute(name) << std::endl;
+            }
+    };
+    auto range = [&](const char *name, glm::vec2 &value, int &resolution)
+    {
+        float values[3];
+        if (!element->Attribute(name))
+            return;
+        if (ParseFloats(element->Attribute(name), values, 3) && values[2] >= 1.0f)
         {
-            float x = 0, y = 0, z = 0;
-            if (sub->Attribute("x"))
-                try
-                {
-                    x = std::stof(sub->Attribute("x"));
-                }
-                catch (const std::exception &e)
-                {
-                    std::cout << "Error: invalid x value : " << sub->Attribute("x") << std::endl;
-                }
-            if (sub->Attribute("y"))
-                try
-                {
-                    y = std::stof(sub->Attribute("y"));
-                }
-                catch (const std::exception &e)
-                {
-                    std::cout << "Error: invalid y value : " << sub->Attribute("y") << std::endl;
-                }
-            if (sub->Attribute("z"))
-                try
-                {
-                    z = std::stof(sub->Attribute("z"));
-                }
-                catch (const std::exception &e)
-                {
-                    std::cout << "Error: invalid z value : " << sub->Attribute("z") << std::endl;
-                }
-            position.push_back(glm::vec3(x, y, z));
+            value = glm::vec2(values[0], values[1]);
+            resolution = values[2];
+        }
+        else if (report)
+            std::cout << "Error: invalid " << name << " value : " << element->Attribute(name) << ". Accepted as begin,end,resolution." << std::endl;
+    };
+    parse("radius", surface.radius);
+    parse("tube", surface.tube);
+    parse("height", surface.height);
+    range("u", surface.u, surface.columns);
+    range("v", surface.v, surface.rows);
+
+    const char *preset = element->Attribute("preset");
+    if (preset)
+    {
+        std::string name = preset;
+        std::transform(name.begin(), name.end(), name.begin(), tolower);
+        if (name == "sphere")
+            surface.preset = SurfacePreset::Sphere;
+        else if (name == "torus")
+            surface.preset = SurfacePreset::Torus;
+        else if (name == "capsule")
+            surface.preset = SurfacePreset::Capsule;
+        else if (report)
+            std::cout << "Error: invalid preset value : " << preset << ". Accepted as sphere, torus or capsule." << std::endl;
+        if (surface.preset != SurfacePreset::None)
+            return true;
+    }
+
+    // En : The axes are compiled together, so that the grid is evaluated once. Only if that fails they are compiled one by one, so that the error names the attribute.
+    // Tr : Eksenler birlikte derlenir, böylece ızgara bir kez değerlendirilir. Yalnızca bu başarısız olursa tek tek derlenir, böylece hata niteliği adlandırır.
+    const char *names[] = {"x", "y", "z"}, *defaults[] = {"u", "0", "v"};
+    std::string axes[3];
+    for (int axis = 0; axis < 3; axis++)
+        axes[axis] = element->Attribute(names[axis]) ? element->Attribute(names[axis]) : defaults[axis];
+    if (surface.expression.Compile("vec(" + axes[0] + "," + axes[1] + "," + axes[2] + ")", "uv"))
+        return true;
+    if (!report)
+        return false;
+    ColorExpression axisExpression;
+    for (int axis = 0; axis < 3; axis++)
+        if (!axisExpression.Compile(axes[axis], "uv"))
+        {
+            std::cout << "Error: invalid " << names[axis] << " value : " << axes[axis] << " (" << axisExpression.GetError() << ")." << std::endl;
+            return false;
         }
+    std::cout << "Error: invalid surface expression : " << surface.expression.GetError() << std::endl;
+    return false;
+}
+
+// En : Get the surface of an element from the cache. The positional handler is called first for every element, it always reads the surface and reports its errors.
+// Tr : Bir elemanın yüzeyini önbellekten al. Konum işleyicisi her eleman için ilk çağrılır, yüzeyi her zaman okur ve hatalarını bildirir.
+SurfaceCache &CachedSurface(tinyxml2::XMLElement *element, bool read)
+{
+    if (read || surfaceCache.element != element)
+    {
+        surfaceCache.element = element;
+        surfaceCache.surface = ParametricSurface();
+        surfaceCache.valid = ReadSurface(element, surfaceCache.surface, read);
+        std::vector<glm::vec3>().swap(surfaceCache.positions);
     }
-    for (glm::vec3 v : position)
+    return surfaceCache;
+}
+
+glm::vec3 *SurfacePositionalData(tinyxml2::XMLElement *element, int &size)
+{
+    // En : A surface that cannot be read has no vertices, like an import that cannot be read.
+    // Tr : Okunamayan bir yüzeyin köşesi yoktur, okunamayan bir içe aktarma gibi.
+    SurfaceCache &cache = CachedSurface(element, true);
+    size = cache.valid ? SurfaceVertexCount(cache.surface) : 0;
+    glm::vec3 *position = new glm::vec3[size];
+    if (!size)
+        return position;
+    SurfacePositions(cache.surface, position);
+    NormalMode mode = ElementNormalMode(element);
+    if (cache.surface.preset == SurfacePreset::None && mode != NormalMode::None && mode != NormalMode::Flat)
+        cache.positions.assign(position, position + size);
+    return position;
+}
+
+glm::vec3 *CircleNormalData(tinyxml2::XMLElement *element, int &size)
+{
+    int resolution = 32;
+    if (element->Attribute("resolution"))
+        try
+        {
+            resolution = std::stoi(element->Attribute("resolution"));
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << "Error: invalid resolution value : " << element->Attribute("resolution") << std::endl;
+        }
+    // En : CircleIndexData winds its triangles towards -y.
+    // Tr : CircleIndexData üçgenlerini -y yönüne sarar.
+    size = resolution + 1;
+    glm::vec3 *normal = new glm::vec3[size];
+    for (int i = 0; i < size; i++)
+        normal[i] = glm::vec3(0, -1, 0);
+    return normal;
+}
+
+glm::vec3 *CylinderNormalData(tinyxml2::XMLElement *element, int &size)
+{
+    int resolution = 32;
+    if (element->Attribute("resolution"))
+        try
+        {
+            resolution = std::stoi(element->Attribute("resolution"));
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << "Error: invalid resolution value : " << element->Attribute("resolution") << std::endl;
+        }
+    // En : Ring vertices are shared by the side and the caps, so they get the radial normal of the side.
+    // Tr : Halka köşeleri yan yüz ve kapaklar arasında paylaşılır, bu yüzden yan yüzün radyal normalini alırlar.
+    size = 2 * resolution + 2;
+    glm::vec3 *normal = new glm::vec3[size];
+    for (int i = 0; i < resolution; i++)
     {
-        position.push_back(v + glm::vec3(0, height, 0));
+        float angle = 2 * PI * i / resolution;
+        normal[i] = normal[i + resolution] = glm::vec3(cos(angle), 0, sin(angle));
     }
-    size = position.size();
-    glm::vec3 *positionArray = position.data();
-    return positionArray;
+    normal[size - 1] = glm::vec3(0, -1, 0);
+    normal[size - 2] = glm::vec3(0, 1, 0);
+    return normal;
+}
+
+glm::vec3 *ConeNormalData(tinyxml2::XMLElement *element, int &size)
+{
+    float radius = 1.0f, height = 1.0f;
+    if (element->Attribute("radius"))
+        try
+        {
+            radius = std::stof(element->Attribute("radius"));
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << "Error: invalid radius value : " << element->Attribute("radius") << std::endl;
+        }
+    if (element->Attribute("height"))
+        try
+        {
+            height = std::stof(element->Attribute("height"));
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << "Error: invalid height value : " << element->Attribute("height") << std::endl;
+        }
+    int resolution = 32;
+    if (element->Attribute("resolution"))
+        try
+        {
+            resolution = std::stoi(element->Attribute("resolution"));
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << "Error: invalid resolution value : " << element->Attribute("resolution") << std::endl;
+        }
+    // En : The slanted side normal leans up by radius / height.
+    // Tr : Eğik yan yüz normali radius / height oranında yukarı eğilir.
+    size = resolution + 2;
+    glm::vec3 *normal = new glm::vec3[size];
+    for (int i = 0; i < resolution; i++)
+    {
+        float angle = 2 * PI * i / resolution;
+        normal[i] = glm::normalize(glm::vec3(height * cos(angle), radius, height * sin(angle)));
+    }
+    normal[resolution] = glm::vec3(0, 1, 0);
+    normal[resolution + 1] = glm::vec3(0, -1, 0);
+    return normal;
+}
+
+glm::vec3 *SurfaceNormalData(tinyxml2::XMLElement *element, int &size)
+{
+    // En : Normals are differenced over the positions of the positional handler, which are released afterwards.
+    // Tr : Normaller konum işleyicisinin pozisyonları üzerinden farklanır, bunlar ardından serbest bırakılır.
+    SurfaceCache &cache = CachedSurface(element, false);
+    size = cache.valid ? SurfaceVertexCount(cache.surface) : 0;
+    glm::vec3 *normal = new glm::vec3[size];
+    if (!size)
+        return normal;
+    if (cache.surface.preset == SurfacePreset::None && (int)cache.positions.size() != size)
+    {
+        cache.positions.resize(size);
+        SurfacePositions(cache.surface, cache.positions.data());
+    }
+    SurfaceNormals(cache.surface, cache.positions.data(), normal);
+    std::vector<glm::vec3>().swap(cache.positions);
+    return normal;
+}
+
+glm::vec2 *SurfaceUVData(tinyxml2::XMLElement *element, int &size)
+{
+    SurfaceCache &cache = CachedSurface(element, false);
+    size = cache.valid ? SurfaceVertexCount(cache.surface) : 0;
+    glm::vec2 *uv = new glm::vec2[size];
+    if (size)
+        SurfaceUVs(cache.surface, uv);
+    return uv;
 }
 
 glm::vec3 *AddColorData(int size, glm::vec3 color)
@@ -386,9 +996,13 @@ glm::vec3 *AddColorData(int size, glm::vec3 color)
 }
 
 glm::vec3 *AddColorData(int size, tinyxml2::XMLElement *element)
+{
+    return AddColorData(size, ElementColor(element));
+}
+
+glm::vec3 ElementColor(tinyxml2::XMLElement *element)
 {
     glm::vec3 color = glm::vec3(0.0f, 0.0f, 0.0f);
-    glm::vec3 *output = new glm::vec3[size];
     if (element->Attribute("color"))
     {
         try
@@ -422,8 +1036,26 @@ glm::vec3 *AddColorData(int size, tinyxml2::XMLElement *element)
             std::cout << "Error: invalid color value : " << element->Attribute("color") << ". Accepted as 0x000000." << std::endl;
         }
     }
-    for (int i = 0; i < size; i++)
-        output[i] = color;
+    return color;
+}
+
+glm::vec3 *AddParametricColorData(int size, std::function<glm::vec3(glm::vec3)> colorFunction, glm::vec3 *positonalData)
+{
+    // En : The function gets the position of every vertex, or the origin if there are no positions.
+    // Tr : Fonksiyon her köşenin pozisyonunu alır, pozisyon yoksa orijini.
+    glm::vec3 *output = new glm::vec3[size];
+    ParallelFor(0, size, 4096, [&](int first, int last)
+                {
+                    for (int i = first; i < last; i++)
+                        output[i] = colorFunction(positonalData ? positonalData[i] : glm::vec3(0.0f));
+                });
+    return output;
+}
+
+glm::vec3 *AddParametricColorData(int size, const ColorExpression &expression, const glm::vec3 *positionalData)
+{
+    glm::vec3 *output = new glm::vec3[size];
+    expression.Evaluate(positionalData, output, size);
     return output;
 }
 
@@ -555,14 +1187,65 @@ int *ArrayIndexData(tinyxml2::XMLElement *element, int &size)
         }
     }
     size = indices.size();
-    int *indexArray = indices.data();
+    int *indexArray = new int[size];
+    std::copy(indices.begin(), indices.end(), indexArray);
     return indexArray;
 }
 
 int *PrismIndexData(tinyxml2::XMLElement *element, int &size)
 {
-    // TODO: Implement this function
-    throw std::exception();
+    // En : The caps are triangulated once in the xz plane. The bottom cap faces down, the top cap is the same triangles reversed.
+    // Tr : Kapaklar xz düzleminde bir kez üçgenlenir. Alt kapak aşağı bakar, üst kapak ters çevrilmiş aynı üçgenlerdir.
+    std::vector<glm::vec3> ring;
+    std::vector<int> holes;
+    PrismRings(element, ring, holes, false);
+    int count = ring.size();
+    std::vector<glm::vec2> plane(count);
+    for (int i = 0; i < count; i++)
+        plane[i] = glm::vec2(ring[i].x, ring[i].z);
+    std::vector<int> cap = Triangulate(plane, holes);
+    size = cap.size() * 2 + count * 6;
+    int *indexArray = new int[size];
+    int *output = indexArray;
+    for (int i = 0; i < (int)cap.size(); i += 3)
+    {
+        output[0] = cap[i];
+        output[1] = cap[i + 1];
+        output[2] = cap[i + 2];
+        output[3] = count + cap[i];
+        output[4] = count + cap[i + 2];
+        output[5] = count + cap[i + 1];
+        output += 6;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        int wall = count * 2 + i * 4;
+        int quad[] = {wall, wall + 2, wall + 1, wall, wall + 3, wall + 2};
+        output = std::copy(quad, quad + 6, output);
+    }
+    return indexArray;
+}
+
+int *ImportIndexData(tinyxml2::XMLElement *element, int &size)
+{
+    size = 0;
+    std::shared_ptr<const ImportedMesh> mesh = element->Attribute("src") ? ImportMesh(element->Attribute("src")) : nullptr;
+    if (!mesh)
+        return new int[0];
+    size = mesh->indices.size();
+    int *indexArray = new int[size];
+    std::copy(mesh->indices.begin(), mesh->indices.end(), indexArray);
+    return indexArray;
+}
+
+int *SurfaceIndexData(tinyxml2::XMLElement *element, int &size)
+{
+    SurfaceCache &cache = CachedSurface(element, false);
+    size = cache.valid ? SurfaceIndexCount(cache.surface) : 0;
+    int *index = new int[size];
+    if (size)
+        SurfaceIndices(cache.surface, index);
+    return index;
 }
 
 glm::vec3 *Translate(glm::vec3 *input, int size, glm::vec3 offset)
@@ -621,6 +1304,15 @@ glm::vec3 *Scale(glm::vec3 *input, int size, glm::vec3 scale)
 
 glm::vec3 *ApplyTranforms(tinyxml2::XMLElement *element, glm::vec3 *input, int size)
 {
+    // En : Every transform returns a new array. The intermediate ones are freed, the input is left to the caller.
+    // Tr : Her dönüşüm yeni bir dizi döndürür. Ara diziler serbest bırakılır, girdi çağırana bırakılır.
+    glm::vec3 *original = input;
+    auto replace = [&](glm::vec3 *output)
+    {
+        if (input != original)
+            delete[] input;
+        input = output;
+    };
     glm::vec3 scale = glm::vec3(1, 1, 1);
     if (element->Attribute("scale"))
     {
@@ -647,7 +1339,7 @@ glm::vec3 *ApplyTranforms(tinyxml2::XMLElement *element, glm::vec3 *input, int s
         {
             std::cout << "Error: invalid scale value : " << element->Attribute("scale") << ". Accepted as (1,1,1)." << std::endl;
         }
-        input = Scale(input, size, scale);
+        replace(Scale(input, size, scale));
     }
     if (element->Attribute("rotation"))
     {
@@ -675,7 +1367,7 @@ glm::vec3 *ApplyTranforms(tinyxml2::XMLElement *element, glm::vec3 *input, int s
                 }
                 vec[2] = std::stof(ss.str());
                 rotation = glm::vec3(vec[0], vec[1], vec[2]);
-                input = Rotate(input, size, rotation);
+                replace(Rotate(input, size, rotation));
             }
             catch (const std::exception &e)
             {
@@ -704,7 +1396,7 @@ glm::vec3 *ApplyTranforms(tinyxml2::XMLElement *element, glm::vec3 *input, int s
                 }
                 vec[3] = std::stof(ss.str());
                 glm::quat rotation = glm::quat(vec[0], vec[1], vec[2], vec[3]);
-                input = Rotate(input, size, rotation);
+                replace(Rotate(input, size, rotation));
             }
             catch (const std::exception &e)
             {
@@ -739,7 +1431,167 @@ glm::vec3 *ApplyTranforms(tinyxml2::XMLElement *element, glm::vec3 *input, int s
         {
             std::cout << "Error: invalid offset value : " << element->Attribute("offset") << ". Accepted as (0,0,0)." << std::endl;
         }
-        input = Translate(input, size, offset);
+        replace(Translate(input, size, offset));
     }
     return input;
 }
+
+
+glm::mat4 ElementMatrix(tinyxml2::XMLElement *element, glm::vec3 center)
+{
+    // En : Every transform is affine and keeps the center of the points it moves. Six points around the center are transformed like the vertices would be, their differences are the columns of the matrix.
+    // Tr : Her dönüşüm afindir ve taşıdığı noktaların merkezini korur. Merkez etrafındaki altı nokta köşelerin dönüştürüleceği gibi dönüştürülür, farkları matrisin sütunlarıdır.
+    glm::vec3 points[6];
+    for (int axis = 0; axis < 3; axis++)
+    {
+        glm::vec3 direction(0.0f);
+        direction[axis] = 1.0f;
+        points[2 * axis] = center + direction;
+        points[2 * axis + 1] = center - direction;
+    }
+    glm::vec3 *output = ApplyTranforms(element, points, 6);
+    glm::mat4 matrix(1.0f);
+    glm::vec3 moved(0.0f);
+    for (int axis = 0; axis < 3; axis++)
+    {
+        matrix[axis] = glm::vec4((output[2 * axis] - output[2 * axis + 1]) * 0.5f, 0.0f);
+        moved += (output[2 * axis] + output[2 * axis + 1]) * 0.5f;
+    }
+    moved /= 3.0f;
+    matrix[3] = glm::vec4(moved - glm::vec3(matrix * glm::vec4(center, 0.0f)), 1.0f);
+    if (output != points)
+        delete[] output;
+    return matrix;
+}
+
+glm::vec3 *ApplyNormalTransforms(tinyxml2::XMLElement *element, glm::vec3 *input, int size)
+{
+    // En : Normals follow the inverse scale and the rotation, and ignore the offset.
+    // Tr : Normaller ters ölçeği ve dönüşü takip eder, ötelemeyi yok sayar.
+    glm::vec3 *output = new glm::vec3[size];
+    float scale[3] = {1, 1, 1}, rotation[4];
+    if (element->Attribute("scale") && !ParseFloats(element->Attribute("scale"), scale, 3))
+        scale[0] = scale[1] = scale[2] = 1;
+    const char *rotationText = element->Attribute("rotation");
+    bool euler = rotationText && ParseFloats(rotationText, rotation, 3);
+    bool quaternion = rotationText && !euler && ParseFloats(rotationText, rotation, 4);
+    for (int i = 0; i < size; i++)
+    {
+        glm::vec3 v = input[i] / glm::vec3(scale[0], scale[1], scale[2]);
+        if (euler)
+        {
+            v = glm::rotateX(v, rotation[0]);
+            v = glm::rotateY(v, rotation[1]);
+            v = glm::rotateZ(v, rotation[2]);
+        }
+        else if (quaternion)
+        {
+            // En : The same linear map as Rotate(glm::vec3 *, int, glm::quat), so normals stay with the vertices.
+            // Tr : Rotate(glm::vec3 *, int, glm::quat) ile aynı doğrusal dönüşüm, böylece normaller köşelerle uyumlu kalır.
+            float w = rotation[0], x = rotation[1], y = rotation[2], z = rotation[3];
+            v = glm::vec3(
+                w * v.x + y * v.z - z * v.y,
+                w * v.y - x * v.z + z * v.z,
+                w * v.z + x * v.y - y * v.x);
+        }
+        float length = glm::length(v);
+        output[i] = length > 0 ? v / length : input[i];
+    }
+    return output;
+}
+
+NormalMode ElementNormalMode(tinyxml2::XMLElement *element)
+{
+    if (GlobalNormalMode == NormalMode::None)
+        return NormalMode::None;
+    NormalMode mode = ParseNormalMode(element->Attribute("normals"), GlobalNormalMode);
+    return mode == NormalMode::None ? GlobalNormalMode : mode;
+}
+
+bool ParseFloats(const char *text, float *output, int count)
+{
+    int i = 0;
+    std::stringstream ss;
+    for (const char *c = text;; c++)
+    {
+        if (*c == ',' || *c == '\0')
+        {
+            if (i == count)
+                return false;
+            try
+            {
+                output[i++] = std::stof(ss.str());
+            }
+            catch (const std::exception &e)
+            {
+                return false;
+            }
+            ss.str("");
+            if (*c == '\0')
+                break;
+        }
+        else if (!std::isspace(*c))
+            ss << *c;
+    }
+    return i == count;
+}
+bool ElementProcedural(tinyxml2::XMLElement *element, bool fallback)
+{
+    if (!element->Attribute("procedural"))
+        return fallback && !element->Attribute("colorExpr") && ElementNormalMode(element) != NormalMode::Flat;
+    std::string value = element->Attribute("procedural");
+    std::transform(value.begin(), value.end(), value.begin(), tolower);
+    if (value != "true" && value != "false")
+    {
+        std::cout << "Error: invalid procedural value : " << element->Attribute("procedural") << ". Accepted as " << (fallback ? "true" : "false") << "." << std::endl;
+        value = fallback ? "true" : "false";
+    }
+    return value == "true" && !element->Attribute("colorExpr") && ElementNormalMode(element) != NormalMode::Flat;
+}
+
+bool ReadPrimitive(tinyxml2::XMLElement *element, const std::string &tag, Primitive &primitive)
+{
+    if (tag == "circle")
+        primitive.type = PrimitiveType::Circle;
+    else if (tag == "cylinder")
+        primitive.type = PrimitiveType::Cylinder;
+    else if (tag == "cone")
+        primitive.type = PrimitiveType::Cone;
+    else
+        return false;
+    // En : The defaults and the reports are the same as the ones of the positional handlers.
+    // Tr : Varsayılanlar ve bildirimler pozisyon işleyicilerininkilerle aynıdır.
+    primitive.radius = 1.0f;
+    primitive.height = primitive.type == PrimitiveType::Circle ? 0.0f : 1.0f;
+    primitive.resolution = 32;
+    primitive.object = -1;
+    if (element->Attribute("radius") && !ParseFloats(element->Attribute("radius"), &primitive.radius, 1))
+    {
+        std::cout << "Error: invalid radius value : " << element->Attribute("radius") << std::endl;
+        primitive.radius = 1.0f;
+    }
+    if (primitive.type != PrimitiveType::Circle && element->Attribute("height") && !ParseFloats(element->Attribute("height"), &primitive.height, 1))
+    {
+        std::cout << "Error: invalid height value : " << element->Attribute("height") << std::endl;
+        primitive.height = 1.0f;
+    }
+    if (element->Attribute("resolution"))
+        try
+        {
+            primitive.resolution = std::stoi(element->Attribute("resolution"));
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << "Error: invalid resolution value : " << element->Attribute("resolution") << std::endl;
+        }
+    primitive.transform = ElementMatrix(element, PrimitiveCenter(primitive));
+    return true;
+}
+
+int PrimitiveVertexCount(const Primitive &primitive)
+{
+    // En : Triangles per segment : the circle has one, the cone its side and bottom, the cylinder two for the side and one for every cap.
+    // Tr : Segment başına üçgenler : dairenin bir, koninin yan yüzü ve tabanı, silindirin yan yüz için iki ve her kapak için bir.
+    const int triangles[] = {1, 4, 2};
+    return 3 * triangles[(int)primitive.type] * std::max(primitive.resolution, 0);
+}
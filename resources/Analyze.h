@@ -13,20 +13,127 @@
 #include <string>
 #include <map>
 #include <functional>
-#include <variant>
+#include "Normals.h"
+#include "Expression.h"
+#include "Surface.h"
+#include "Streams.h"
 
 #ifndef ANALYZE_H
 #define ANALYZE_H
 
 // TODO: Consider to add new tags.
 
-// En : Type definion for the data collected from the XML file.
-// Tr : XML dosyasından toplanan veriler için tip tanımı.
-typedef std::map<std::string, std::variant<std::vector<glm::vec3>, std::vector<int>, std::vector<glm::vec2>>> MeshData;
+// En : A container element of the scene. Parent is the index of the enclosing group, -1 for the root. Rotation is in degrees.
+// Tr : Sahnenin bir kapsayıcı elemanı. Parent, kapsayan grubun indisidir, kök için -1. Dönme derece cinsindendir.
+struct SceneGroup
+{
+    int parent;
+    glm::vec3 offset, rotation, scale;
+};
+
+// En : Material of an element, stored once per object instead of per vertex. Every field is one RGBA texel of the material buffer.
+// Tr : Bir elemanın malzemesi, köşe başına yerine nesne başına bir kez saklanır. Her alan malzeme tamponunun bir RGBA tekselidir.
+struct Material
+{
+    glm::vec4 color;
+};
+
+// En : Round elements that can be drawn without vertices. The values are also the types read by the procedural vertex shader.
+// Tr : Köşeler olmadan çizilebilen yuvarlak elemanlar. Değerler aynı zamanda prosedürel köşe gölgelendiricisinin okuduğu tiplerdir.
+enum class PrimitiveType
+{
+    Circle,
+    Cylinder,
+    Cone
+};
+
+// En : Parameters of a procedural element. Transform is the affine map of the offset, rotation and scale attributes, object is the scene wide element index.
+// Tr : Prosedürel bir elemanın parametreleri. Transform, offset, rotation ve scale niteliklerinin afin dönüşümüdür, object sahne genelindeki eleman indisidir.
+struct Primitive
+{
+    glm::mat4 transform;
+    float radius, height;
+    int resolution;
+    PrimitiveType type;
+    int object;
+};
+
+// En : A pose of an animated object at a time in seconds. Rotation is in degrees.
+// Tr : Animasyonlu bir nesnenin saniye cinsinden bir andaki duruşu. Dönme derece cinsindendir.
+struct Keyframe
+{
+    float time;
+    glm::vec3 offset, rotation, scale;
+};
+
+// En : Animation of an element. Spin is in degrees per second, the oscillation moves the object by amplitude * sin(2 * pi * frequency * t + phase). Keyframes are looped.
+// Tr : Bir elemanın animasyonu. Spin saniye başına derece cinsindendir, salınım nesneyi amplitude * sin(2 * pi * frequency * t + phase) kadar taşır. Anahtar kareler döngüye alınır.
+// En : The pivot is the center of the element, computed once at load time.
+// Tr : Pivot elemanın merkezidir, yükleme sırasında bir kez hesaplanır.
+struct AnimationData
+{
+    int object;
+    glm::vec3 pivot, spin, amplitude;
+    float frequency, phase;
+    std::vector<Keyframe> keyframes;
+};
+
+// En : A part of the scene. Indices are scene wide, positions start at vertexBase. Objects are the vertex ranges of the elements.
+// Tr : Sahnenin bir parçası. İndeksler sahne genelindedir, pozisyonlar vertexBase'den başlar. Objects, elemanların köşe aralıklarıdır.
+// En : The "object" data holds the scene wide element index of every vertex.
+// Tr : "object" verisi her köşenin sahne genelindeki eleman indisini tutar.
+struct MeshChunk
+{
+    VertexStreams data;
+    std::vector<glm::ivec2> objects;
+    // En : Groups opened in this chunk, in scene order, and the group of every element, parallel to objects.
+    // Tr : Bu parçada açılan gruplar, sahne sırasında, ve her elemanın grubu, objects ile paraleldir.
+    std::vector<SceneGroup> groups;
+    std::vector<int> objectGroups;
+    // En : Animations of the elements of this chunk. Object is the scene wide element index.
+    // Tr : Bu parçanın elemanlarının animasyonları. Object, sahne genelindeki eleman indisidir.
+    std::vector<AnimationData> animations;
+    // En : Ranges of the elements in the scene wide index buffer, parallel to objects.
+    // Tr : Elemanların sahne genelindeki index tamponundaki aralıkları, objects ile paraleldir.
+    std::vector<glm::ivec2> objectIndices;
+    // En : Materials of the elements, parallel to objects. Vertex colors are only present if the scene has a colorExpr gradient, they multiply the material color.
+    // Tr : Elemanların malzemeleri, objects ile paraleldir. Köşe renkleri yalnızca sahnede bir colorExpr gradyanı varsa bulunur, malzeme rengiyle çarpılır.
+    std::vector<Material> materials;
+    // En : Elements drawn by the procedural vertex shader. Their objects have empty vertex and index ranges.
+    // Tr : Prosedürel köşe gölgelendiricisi tarafından çizilen elemanlar. Nesnelerinin köşe ve indis aralıkları boştur.
+    std::vector<Primitive> primitives;
+    int vertexBase = 0;
+    int indexBase = 0;
+    int elementCount = 0;
+};
 
 // En : The function that will analyze the XML file and extract or overwrite the data.
 // Tr : XML dosyasını analiz edecek ve verileri çıkaracak veya üzerine yazacak olan fonksiyon.
-void AnalyzeTag(tinyxml2::XMLElement *element, MeshData &data);
+void AnalyzeTag(tinyxml2::XMLElement *element, VertexStreams &data);
+
+// En : Chunked version of AnalyzeTag. Flush is called whenever a chunk reaches chunkSize vertices, and once at the end.
+// Tr : AnalyzeTag'in parçalı sürümü. Flush, bir parça chunkSize köşeye ulaştığında ve sonda bir kez çağrılır.
+void AnalyzeTag(tinyxml2::XMLElement *element, int chunkSize, const std::function<void(MeshChunk &)> &flush);
+
+// En : Count the predefined tags under an element.
+// Tr : Bir elemanın altındaki önceden tanımlanmış etiketleri say.
+int CountTags(tinyxml2::XMLElement *element);
+
+// En : Check whether a predefined tag occurs under an element.
+// Tr : Bir elemanın altında önceden tanımlanmış bir etiketin bulunup bulunmadığını kontrol et.
+bool ContainsTag(tinyxml2::XMLElement *element, const std::string &name);
+
+// En : Check whether an element under an element has an attribute.
+// Tr : Bir elemanın altındaki bir elemanın bir niteliğe sahip olup olmadığını kontrol et.
+bool ContainsAttribute(tinyxml2::XMLElement *element, const char *name);
+
+// En : Read the offset, rotation and scale of a container element. Invalid values are reported and replaced by the identity.
+// Tr : Bir kapsayıcı elemanın öteleme, dönme ve ölçeğini oku. Geçersiz değerler bildirilir ve birim dönüşümle değiştirilir.
+SceneGroup AnalyzeGroup(tinyxml2::XMLElement *element, int parent);
+
+// En : Read the spin, oscillation and keyframe children of an element. Returns false if the element is not animated.
+// Tr : Bir elemanın spin, salınım ve anahtar kare çocuklarını oku. Eleman animasyonlu değilse false döndürür.
+bool AnalyzeAnimation(tinyxml2::XMLElement *element, AnimationData &animation);
 
 // En : The functions that will postional data from the related XML tags.
 // Tr : İlgili XML etiketlerinden pozisyon verilerini alacak olan fonksiyonlar.
@@ -36,12 +143,35 @@ glm::vec3 *CylinderPositionalData(tinyxml2::XMLElement *element, int &size);
 glm::vec3 *ConePositionalData(tinyxml2::XMLElement *element, int &size);
 glm::vec3 *ArrayPositionalData(tinyxml2::XMLElement *element, int &size);
 glm::vec3 *PrismPositionalData(tinyxml2::XMLElement *element, int &size);
+glm::vec3 *ImportPositionalData(tinyxml2::XMLElement *element, int &size);
+glm::vec3 *SurfacePositionalData(tinyxml2::XMLElement *element, int &size);
+
+// En : Read the outline and the <Hole> rings of a prism. Vertices are concatenated, holes holds the first vertex of every hole. Errors are printed only if report is set, as both prism handlers read the rings.
+// Tr : Bir prizmanın dış çizgisini ve <Hole> halkalarını oku. Köşeler art arda eklenir, holes her deliğin ilk köşesini tutar. Her iki prizma işleyicisi de halkaları okuduğundan hatalar yalnızca report ayarlıysa yazdırılır.
+void PrismRings(tinyxml2::XMLElement *element, std::vector<glm::vec3> &ring, std::vector<int> &holes, bool report = true);
+
+// En : Read a surface, either a preset ("sphere", "torus", "capsule") or the x, y and z expressions over u and v. u and v are given as "begin,end,resolution". Returns false if an expression is malformed, errors are printed only if report is set.
+// Tr : Bir yüzeyi oku, ya hazır bir yüzey ("sphere", "torus", "capsule") ya da u ve v üzerindeki x, y ve z ifadeleri. u ve v "begin,end,resolution" olarak verilir. Bir ifade hatalıysa false döndürür, hatalar yalnızca report ayarlıysa yazdırılır.
+bool ReadSurface(tinyxml2::XMLElement *element, ParametricSurface &surface, bool report = true);
+
+// En : The functions that will generate analytic normals for the tags whose surface is known. Other tags get generated normals.
+// Tr : Yüzeyi bilinen etiketler için analitik normalleri oluşturacak olan fonksiyonlar. Diğer etiketler oluşturulmuş normaller alır.
+glm::vec3 *CircleNormalData(tinyxml2::XMLElement *element, int &size);
+glm::vec3 *CylinderNormalData(tinyxml2::XMLElement *element, int &size);
+glm::vec3 *ConeNormalData(tinyxml2::XMLElement *element, int &size);
+glm::vec3 *SurfaceNormalData(tinyxml2::XMLElement *element, int &size);
+
+// En : The functions that will generate texture coordinates. Tags without them get zeros, if the scene has any.
+// Tr : Doku koordinatlarını oluşturacak olan fonksiyonlar. Bunlara sahip olmayan etiketler, sahnede varsa sıfır alır.
+glm::vec2 *SurfaceUVData(tinyxml2::XMLElement *element, int &size);
 
 // En : The functions that will add color data.
 // Tr : Renk verilerini ekleyecek olan fonksiyonlar.
+glm::vec3 ElementColor(tinyxml2::XMLElement *element);
 glm::vec3 *AddColorData(int size, glm::vec3 color);
 glm::vec3 *AddColorData(int size, tinyxml2::XMLElement *element);
 glm::vec3 *AddParametricColorData(int size, std::function<glm::vec3(glm::vec3)> colorFunction, glm::vec3 *positonalData = nullptr);
+glm::vec3 *AddParametricColorData(int size, const ColorExpression &expression, const glm::vec3 *positionalData);
 
 // En : The functions that will generate the index data from the related XML tags.
 // Tr : İlgili XML etiketlerinden index verilerini oluşturacak olan fonksiyonlar.
@@ -51,6 +181,8 @@ int *CylinderIndexData(tinyxml2::XMLElement *element, int &size);
 int *ConeIndexData(tinyxml2::XMLElement *element, int &size);
 int *ArrayIndexData(tinyxml2::XMLElement *element, int &size);
 int *PrismIndexData(tinyxml2::XMLElement *element, int &size);
+int *ImportIndexData(tinyxml2::XMLElement *element, int &size);
+int *SurfaceIndexData(tinyxml2::XMLElement *element, int &size);
 
 // En : Tranform functions for the positional data.
 // Tr : Pozisyon verileri için dönüşüm fonksiyonları.
@@ -60,5 +192,27 @@ glm::vec3 *Rotate(glm::vec3 *input, int size, glm::quat rotaion);
 glm::vec3 *Scale(glm::vec3 *input, int size, glm::vec3 scale);
 
 glm::vec3 *ApplyTranforms(tinyxml2::XMLElement *element, glm::vec3 *input, int size);
+// En : The same transforms as one matrix. Rotations turn around the center of the vertices, so the center of the untransformed element is needed.
+// Tr : Aynı dönüşümler tek bir matris olarak. Dönmeler köşelerin merkezi etrafında yapılır, bu yüzden dönüştürülmemiş elemanın merkezi gerekir.
+glm::mat4 ElementMatrix(tinyxml2::XMLElement *element, glm::vec3 center);
+glm::vec3 *ApplyNormalTransforms(tinyxml2::XMLElement *element, glm::vec3 *input, int size);
+
+// En : Get the normal mode of an element. The "normals" attribute overrides the global mode, unless normals are disabled.
+// Tr : Bir elemanın normal modunu al. "normals" niteliği, normaller kapalı değilse global modu geçersiz kılar.
+NormalMode ElementNormalMode(tinyxml2::XMLElement *element);
+
+// En : Parse a comma separated list of floats. Returns false if the count does not match.
+// Tr : Virgülle ayrılmış bir float listesini ayrıştır. Sayı uyuşmazsa false döndürür.
+bool ParseFloats(const char *text, float *output, int count);
+
+// En : Whether a circle, cylinder or cone element is drawn procedurally. The "procedural" attribute of the element overrides fallback, which is the attribute of the root. Elements with a colorExpr or flat normals are always meshed.
+// Tr : Bir daire, silindir veya koni elemanının prosedürel çizilip çizilmeyeceği. Elemanın "procedural" niteliği, kökün niteliği olan fallback'i geçersiz kılar. colorExpr veya düz normalleri olan elemanlar her zaman ağ olarak oluşturulur.
+bool ElementProcedural(tinyxml2::XMLElement *element, bool fallback);
+// En : Read the parameters of a procedural element. Returns false if the tag has no procedural form.
+// Tr : Prosedürel bir elemanın parametrelerini oku. Etiketin prosedürel bir biçimi yoksa false döndürür.
+bool ReadPrimitive(tinyxml2::XMLElement *element, const std::string &tag, Primitive &primitive);
+// En : Vertices the procedural vertex shader emits for a primitive, as a triangle list.
+// Tr : Prosedürel köşe gölgelendiricisinin bir ilkel için ürettiği köşeler, üçgen listesi olarak.
+int PrimitiveVertexCount(const Primitive &primitive);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+// En : Definitions of Animation.h file.
+// Tr : Animation.h dosyasının tanımlamaları.
+#include "Animation.h"
+#include "Components.h"
+#include "Jobs.h"
+#include <algorithm>
+#include <cmath>
+
+glm::mat4 EvaluateAnimation(const AnimationData &animation, double time)
+{
+    // En : Angles are wrapped, so that the precision does not decay while the program runs.
+    // Tr : Açılar sarılır, böylece program çalıştıkça hassasiyet azalmaz.
+    glm::vec3 offset(0.0f), rotation, scale(1.0f);
+    for (int i = 0; i < 3; i++)
+        rotation[i] = (float)std::fmod(animation.spin[i] * time, 360.0);
+    if (animation.amplitude != glm::vec3(0.0f))
+        offset += animation.amplitude * (float)std::sin(2.0 * 3.14159265358979323846 * animation.frequency * time + animation.phase);
+
+    // En : Keyframes are interpolated linearly and looped over the time of the last one.
+    // Tr : Anahtar kareler doğrusal olarak ara değerlenir ve sonuncusunun zamanı üzerinden döngüye alınır.
+    const std::vector<Keyframe> &keyframes = animation.keyframes;
+    if (!keyframes.empty())
+    {
+        float duration = keyframes.back().time;
+        float t = duration > 0.0f ? (float)std::fmod(time, (double)duration) : 0.0f;
+        std::vector<Keyframe>::const_iterator next = std::upper_bound(keyframes.begin(), keyframes.end(), t, [](float t, const Keyframe &keyframe)
+                                                                      { return t < keyframe.time; });
+        const Keyframe &b = next == keyframes.end() ? keyframes.back() : *next;
+        const Keyframe &a = next == keyframes.begin() ? b : *(next - 1);
+        float weight = b.time > a.time ? (t - a.time) / (b.time - a.time) : 0.0f;
+        offset += glm::mix(a.offset, b.offset, weight);
+        rotation += glm::mix(a.rotation, b.rotation, weight);
+        scale *= glm::mix(a.scale, b.scale, weight);
+    }
+
+    // En : Rotate and scale around the pivot, then move.
+    // Tr : Pivot etrafında döndür ve ölçekle, sonra taşı.
+    glm::mat3 linear = EulerRotation(rotation);
+    for (int i = 0; i < 3; i++)
+        linear[i] *= scale[i];
+    glm::mat4 local(1.0f);
+    for (int i = 0; i < 3; i++)
+        local[i] = glm::vec4(linear[i], 0.0f);
+    local[3] = glm::vec4(animation.pivot + offset - linear * animation.pivot, 1.0f);
+    return local;
+}
+
+Animator::Animator(int grain) : grain(grain)
+{
+}
+
+AnimationData &Animator::Track(int object)
+{
+    if (object >= (int)objectTracks.size())
+        objectTracks.resize(object + 1, -1);
+    if (objectTracks[object] == -1)
+    {
+        objectTracks[object] = tracks.size();
+        firstObject = firstObject == lastObject ? object : std::min(firstObject, object);
+        lastObject = std::max(lastObject, object + 1);
+        tracks.push_back({object, glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.0f), 1.0f, 0.0f, {}});
+        Account();
+    }
+    return tracks[objectTracks[object]];
+}
+
+void Animator::Account()
+{
+    memory.Set((long long)tracks.capacity() * sizeof(AnimationData) + (long long)objectTracks.capacity() * sizeof(int) + keyframeBytes);
+}
+
+void Animator::Append(const MeshChunk &chunk)
+{
+    for (const AnimationData &animation : chunk.animations)
+    {
+        AnimationData &track = Track(animation.object);
+        keyframeBytes += ((long long)animation.keyframes.size() - (long long)track.keyframes.size()) * sizeof(Keyframe);
+        track = animation;
+    }
+    Account();
+}
+
+void Animator::SetPivot(int object, glm::vec3 pivot)
+{
+    Track(object).pivot = pivot;
+}
+
+void Animator::SetSpin(int object, glm::vec3 degreesPerSecond)
+{
+    Track(object).spin = degreesPerSecond;
+}
+
+void Animator::SetOscillation(int object, glm::vec3 amplitude, float frequency, float phase)
+{
+    AnimationData &track = Track(object);
+    track.amplitude = amplitude;
+    track.frequency = frequency;
+    track.phase = phase;
+}
+
+void Animator::AddKeyframe(int object, const Keyframe &keyframe)
+{
+    std::vector<Keyframe> &keyframes = Track(object).keyframes;
+    keyframes.insert(std::upper_bound(keyframes.begin(), keyframes.end(), keyframe.time, [](float time, const Keyframe &keyframe)
+                                      { return time < keyframe.time; }),
+                     keyframe);
+    keyframeBytes += sizeof(Keyframe);
+    Account();
+}
+
+void Animator::Remove(int object)
+{
+    if (object >= (int)objectTracks.size() || objectTracks[object] == -1)
+        return;
+    // En : The last track takes the place of the removed one.
+    // Tr : Son iz, çıkarılanın yerini alır.
+    int index = objectTracks[object];
+    keyframeBytes -= (long long)tracks[index].keyframes.size() * sizeof(Keyframe);
+    tracks[index] = std::move(tracks.back());
+    objectTracks[tracks[index].object] = index;
+    tracks.pop_back();
+    objectTracks[object] = -1;
+    Account();
+}
+
+int Animator::GetTrackCount() const
+{
+    return tracks.size();
+}
+
+void Animator::Update(SceneGraph &scene, double time)
+{
+    if (tracks.empty())
+        return;
+    int objectCount = scene.GetObjectCount();
+    ParallelFor(0, tracks.size(), grain, [&](int begin, int end)
+                {
+                    for (int i = begin; i < end; i++)
+                    {
+                        const AnimationData &track = tracks[i];
+                        // En : Tracks may be added before their objects reach the scene graph.
+                        // Tr : İzler, nesneleri sahne grafiğine ulaşmadan önce eklenmiş olabilir.
+                        if (track.object < objectCount)
+                            scene.SetObjectLocal(track.object, EvaluateAnimation(track, time));
+                    } });
+    scene.MarkObjects(firstObject, std::min(lastObject, objectCount));
+}
@@ -0,0 +1,61 @@
+// En : This file contains the class prototype for the animation system. Objects are animated by spin, oscillation and keyframe tracks evaluated on every core.
+// Tr : Bu dosya, animasyon sistemi için sınıf prototipini içerir. Nesneler, her çekirdekte değerlendirilen spin, salınım ve anahtar kare izleri ile canlandırılır.
+#include <glm/glm.hpp>
+#include <vector>
+#include "Analyze.h"
+#include "Scene.h"
+#include "Memory.h"
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+// En : Class declaration for the animation system. Every animated object has one track, the tracks are kept in a flat array and evaluated in parallel chunks.
+// Tr : Animasyon sistemi için sınıf bildirimi. Her animasyonlu nesnenin bir izi vardır, izler düz bir dizide tutulur ve paralel parçalar halinde değerlendirilir.
+// En : A track writes the local matrix of its object in the scene graph, rotating and scaling it around the cached pivot.
+// Tr : Bir iz, nesnesinin sahne grafiğindeki yerel matrisini yazar ve onu önbelleğe alınmış pivot etrafında döndürüp ölçekler.
+class Animator
+{
+private:
+    std::vector<AnimationData> tracks;
+    // En : Track index of every object, -1 if the object is not animated.
+    // Tr : Her nesnenin iz indisi, nesne animasyonlu değilse -1.
+    std::vector<int> objectTracks;
+    // En : Range of the animated objects. It only grows, so it may cover removed tracks.
+    // Tr : Animasyonlu nesnelerin aralığı. Yalnızca büyür, bu yüzden çıkarılmış izleri kapsayabilir.
+    int firstObject = 0, lastObject = 0;
+    int grain;
+    // En : The tracks are accounted as objects, keyframes by their count.
+    // Tr : İzler nesne olarak hesaplanır, anahtar kareler sayılarıyla.
+    MemoryAccount memory{MemoryCategory::Objects};
+    long long keyframeBytes = 0;
+    AnimationData &Track(int object);
+    void Account();
+
+public:
+    Animator(int grain = 1024);
+    // En : Add the animations of a chunk produced by AnalyzeTag.
+    // Tr : AnalyzeTag tarafından üretilen bir parçanın animasyonlarını ekle.
+    void Append(const MeshChunk &chunk);
+
+    // En : Tracks are created on first use. Angles are in degrees.
+    // Tr : İzler ilk kullanımda oluşturulur. Açılar derece cinsindendir.
+    void SetPivot(int object, glm::vec3 pivot);
+    void SetSpin(int object, glm::vec3 degreesPerSecond);
+    void SetOscillation(int object, glm::vec3 amplitude, float frequency = 1.0f, float phase = 0.0f);
+    void AddKeyframe(int object, const Keyframe &keyframe);
+    // En : Stop animating an object. Its local matrix keeps the last evaluated pose.
+    // Tr : Bir nesneyi canlandırmayı durdur. Yerel matrisi son değerlendirilen duruşu korur.
+    void Remove(int object);
+    int GetTrackCount() const;
+
+    // En : Evaluate every track at time in seconds. Must be called after SceneGraph::Update and before SceneGraph::Upload.
+    // Tr : Her izi saniye cinsinden time anında değerlendir. SceneGraph::Update'ten sonra ve SceneGraph::Upload'dan önce çağrılmalıdır.
+    void Update(SceneGraph &scene, double time);
+};
+
+Animator GlobalAnimator;
+
+// En : Local matrix of an animation track at a time.
+// Tr : Bir animasyon izinin bir andaki yerel matrisi.
+glm::mat4 EvaluateAnimation(const AnimationData &animation, double time);
+
+#endif
@@ -0,0 +1,585 @@
+// En : Definitions of BVH.h file.
+// Tr : BVH.h dosyasının tanımlamaları.
+#include "BVH.h"
+#include "Jobs.h"
+#include <atomic>
+#include <future>
+#include <algorithm>
+#include <thread>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BVH_SSE
+#endif
+#ifdef OBJECT_H
+#include "Object.h"
+#endif
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const int BVHBinCount = 16;
+const int BVHMaxLeafSize = 4;
+const int BVHParallelThreshold = 1 << 14;
+// En : Traversal keeps at most one entry per level plus the two children of the current node, so leaves are forced at depth BVHStackSize - 1 and the stacks can never overflow.
+// Tr : Geçiş seviye başına en fazla bir giriş ve geçerli düğümün iki çocuğunu tutar, bu yüzden yapraklar BVHStackSize - 1 derinliğinde zorlanır ve yığınlar asla taşamaz.
+const int BVHStackSize = 128;
+
+// En : Axis aligned box used while building.
+// Tr : Oluşturma sırasında kullanılan eksen hizalı kutu.
+struct BVHBounds
+{
+    glm::vec3 min = glm::vec3(FLT_MAX);
+    glm::vec3 max = glm::vec3(-FLT_MAX);
+    void Grow(const glm::vec3 &point)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+    void Grow(const BVHBounds &other)
+    {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+    float Area() const
+    {
+        glm::vec3 e = max - min;
+        return e.x < 0 ? 0.0f : e.x * e.y + e.y * e.z + e.z * e.x;
+    }
+};
+struct BVHBin
+{
+    BVHBounds bounds;
+    int count = 0;
+};
+
+// En : Scratch data of a build. Triangle bounds and centroids are computed once and partitioned through the order array.
+// Tr : Bir oluşturmanın geçici verileri. Üçgen sınırları ve merkezleri bir kez hesaplanır ve sıra dizisi üzerinden bölümlenir.
+struct BVHBuilder
+{
+    std::vector<BVHNode> &nodes;
+    std::vector<int> order;
+    std::vector<BVHBounds> bounds;
+    std::vector<glm::vec3> centroids;
+    std::atomic<int> nodeCount{1};
+    int parallelDepth;
+
+    BVHBuilder(std::vector<BVHNode> &nodes) : nodes(nodes)
+    {
+        parallelDepth = 0;
+        for (unsigned int workers = WorkerCount(); workers > 1; workers >>= 1)
+            parallelDepth++;
+    }
+
+    void RangeBounds(int first, int count, BVHBounds &box, BVHBounds &centroidBox)
+    {
+        if (count < BVHParallelThreshold)
+        {
+            for (int i = first; i < first + count; i++)
+            {
+                box.Grow(bounds[order[i]]);
+                centroidBox.Grow(centroids[order[i]]);
+            }
+            return;
+        }
+        std::vector<BVHBounds> boxes(WorkerCount()), centroidBoxes(WorkerCount());
+        std::atomic<int> slot{0};
+        ParallelFor(first, first + count, BVHParallelThreshold, [&](int begin, int end)
+                    {
+                        int s = slot++;
+                        for (int i = begin; i < end; i++)
+                        {
+                            boxes[s].Grow(bounds[order[i]]);
+                            centroidBoxes[s].Grow(centroids[order[i]]);
+                        } });
+        for (int s = 0; s < slot; s++)
+        {
+            box.Grow(boxes[s]);
+            centroidBox.Grow(centroidBoxes[s]);
+        }
+    }
+
+    void Bin(int first, int count, int axis, float origin, float scale, BVHBin *bins)
+    {
+        if (count < BVHParallelThreshold)
+        {
+            for (int i = first; i < first + count; i++)
+            {
+                int t = order[i];
+                int b = std::min(BVHBinCount - 1, (int)((centroids[t][axis] - origin) * scale));
+                bins[b].count++;
+                bins[b].bounds.Grow(bounds[t]);
+            }
+            return;
+        }
+
+        // En : Large ranges are binned in chunks on every core and merged afterwards.
+        // Tr : Büyük aralıklar her çekirdekte parçalar halinde kutulanır ve sonra birleştirilir.
+        std::vector<BVHBin> partial(WorkerCount() * BVHBinCount);
+        std::atomic<int> slot{0};
+        ParallelFor(first, first + count, BVHParallelThreshold, [&](int begin, int end)
+                    {
+                        BVHBin *local = &partial[(slot++) * BVHBinCount];
+                        for (int i = begin; i < end; i++)
+                        {
+                            int t = order[i];
+                            int b = std::min(BVHBinCount - 1, (int)((centroids[t][axis] - origin) * scale));
+                            local[b].count++;
+                            local[b].bounds.Grow(bounds[t]);
+                        } });
+        for (int s = 0; s < slot; s++)
+            for (int b = 0; b < BVHBinCount; b++)
+            {
+                bins[b].count += partial[s * BVHBinCount + b].count;
+                bins[b].bounds.Grow(partial[s * BVHBinCount + b].bounds);
+            }
+    }
+
+    void Subdivide(int nodeIndex, int first, int count, int depth)
+    {
+        BVHBounds box, centroidBox;
+        RangeBounds(first, count, box, centroidBox);
+        BVHNode &node = nodes[nodeIndex];
+        node.min = box.min;
+        node.max = box.max;
+        node.leftFirst = first;
+        node.count = count;
+        if (count <= 1 || depth >= BVHStackSize - 1)
+            return;
+
+        // En : Find the cheapest split plane over all axes by the surface area heuristic.
+        // Tr : Yüzey alanı sezgiseli ile tüm eksenlerdeki en ucuz bölme düzlemini bul.
+        int bestAxis = -1, bestSplit = 0;
+        float bestCost = FLT_MAX;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float extent = centroidBox.max[axis] - centroidBox.min[axis];
+            if (extent <= 0)
+                continue;
+            BVHBin bins[BVHBinCount];
+            float scale = BVHBinCount / extent * 0.9999f;
+            Bin(first, count, axis, centroidBox.min[axis], scale, bins);
+
+            float leftArea[BVHBinCount - 1], rightArea[BVHBinCount - 1];
+            int leftCount[BVHBinCount - 1], rightCount[BVHBinCount - 1];
+            BVHBounds leftBox, rightBox;
+            int leftSum = 0, rightSum = 0;
+            for (int i = 0; i < BVHBinCount - 1; i++)
+            {
+                leftSum += bins[i].count;
+                leftCount[i] = leftSum;
+                leftBox.Grow(bins[i].bounds);
+                leftArea[i] = leftBox.Area();
+                rightSum += bins[BVHBinCount - 1 - i].count;
+                rightCount[BVHBinCount - 2 - i] = rightSum;
+                rightBox.Grow(bins[BVHBinCount - 1 - i].bounds);
+                rightArea[BVHBinCount - 2 - i] = rightBox.Area();
+            }
+            for (int i = 0; i < BVHBinCount - 1; i++)
+            {
+                float cost = leftCount[i] * leftArea[i] + rightCount[i] * rightArea[i];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = i + 1;
+                }
+            }
+        }
+
+        // En : Costs are in units of one triangle test, a traversal step counts as one test.
+        // Tr : Maliyetler bir üçgen testi birimindedir, bir geçiş adımı bir test sayılır.
+        float area = box.Area();
+        float splitCost = area > 0 ? 1.0f + bestCost / area : FLT_MAX;
+        if (count <= BVHMaxLeafSize && (bestAxis == -1 || splitCost >= count))
+            return;
+
+        // En : Partition the triangles, falling back to a median split when every centroid lands on one side.
+        // Tr : Üçgenleri bölümle, tüm merkezler bir tarafa düştüğünde ortanca bölmeye geri dön.
+        int middle = first + count / 2;
+        if (bestAxis != -1)
+        {
+            float origin = centroidBox.min[bestAxis];
+            float scale = BVHBinCount / (centroidBox.max[bestAxis] - origin) * 0.9999f;
+            int *split = std::partition(order.data() + first, order.data() + first + count, [&](int t)
+                                        { return std::min(BVHBinCount - 1, (int)((centroids[t][bestAxis] - origin) * scale)) < bestSplit; });
+            int candidate = (int)(split - order.data());
+            if (candidate != first && candidate != first + count)
+                middle = candidate;
+        }
+
+        int left = nodeCount.fetch_add(2);
+        node.leftFirst = left;
+        node.count = 0;
+
+        // En : Large subtrees are built on their own thread until every core is busy.
+        // Tr : Büyük alt ağaçlar, tüm çekirdekler meşgul olana kadar kendi iş parçacıklarında oluşturulur.
+        if (count >= BVHParallelThreshold && depth < parallelDepth)
+        {
+            std::future<void> leftTask = std::async(std::launch::async, [=]
+                                                    { Subdivide(left, first, middle - first, depth + 1); });
+            Subdivide(left + 1, middle, first + count - middle, depth + 1);
+            leftTask.get();
+        }
+        else
+        {
+            Subdivide(left, first, middle - first, depth + 1);
+            Subdivide(left + 1, middle, first + count - middle, depth + 1);
+        }
+    }
+};
+
+void BVH::Build(const float *positions, int stride, const std::vector<int> &index, const int *vertexObjects)
+{
+    this->positions = positions;
+    this->stride = stride;
+    this->vertexObjects = vertexObjects;
+#ifdef SCENE_H
+    sceneVersion = GlobalScene.GetVersion();
+#endif
+    int triangleCount = index.size() / 3;
+
+    nodes.assign(std::max(2 * triangleCount - 1, 1), BVHNode());
+    triangles.resize(triangleCount);
+    objects.assign(triangleCount, -1);
+    triangleIndices.resize(triangleCount);
+    vertices.resize(3 * triangleCount);
+    if (!triangleCount)
+    {
+        nodes[0] = {glm::vec3(0.0f), 0, glm::vec3(0.0f), 0};
+        return;
+    }
+
+    // En : Step 1 : Compute the bounds and centroid of every triangle.
+    // Tr : Adım 1 : Her üçgenin sınırlarını ve merkezini hesapla.
+    BVHBuilder builder(nodes);
+    builder.order.resize(triangleCount);
+    builder.bounds.resize(triangleCount);
+    builder.centroids.resize(triangleCount);
+    ParallelFor(0, triangleCount, BVHParallelThreshold, [&](int begin, int end)
+                {
+                    for (int t = begin; t < end; t++)
+                    {
+                        builder.order[t] = t;
+                        for (int k = 0; k < 3; k++)
+                            builder.bounds[t].Grow(Position(index[3 * t + k]));
+                        builder.centroids[t] = (builder.bounds[t].min + builder.bounds[t].max) * 0.5f;
+                    } });
+
+    // En : Step 2 : Split the triangles recursively.
+    // Tr : Adım 2 : Üçgenleri özyinelemeli olarak böl.
+    builder.Subdivide(0, 0, triangleCount, 0);
+    nodes.resize(builder.nodeCount);
+
+    // En : Step 3 : Store the triangle data in leaf order and tag it with the owning object.
+    // Tr : Adım 3 : Üçgen verilerini yaprak sırasında sakla ve sahibi olan nesne ile etiketle.
+    ParallelFor(0, triangleCount, BVHParallelThreshold, [&](int begin, int end)
+                {
+                    for (int i = begin; i < end; i++)
+                    {
+                        int t = builder.order[i];
+                        triangles[i] = t;
+                        triangleIndices[i] = glm::ivec3(index[3 * t], index[3 * t + 1], index[3 * t + 2]);
+#ifdef OBJECT_H
+                        std::vector<Object *>::iterator it = std::upper_bound(GlobalObejcts.begin(), GlobalObejcts.end(), triangleIndices[i].x, [](int vertex, Object *o)
+                                                                              { return vertex < o->GetBegin(); });
+                        if (it != GlobalObejcts.begin() && triangleIndices[i].x < (*(it - 1))->GetEnd())
+                            objects[i] = (int)(it - GlobalObejcts.begin()) - 1;
+#endif
+                        UpdateTriangle(i);
+                    } });
+#ifdef OBJECT_H
+    version = GlobalDataVersion;
+#endif
+}
+
+glm::vec3 BVH::Position(int vertex) const
+{
+    const float *p = positions + vertex * stride;
+    glm::vec3 position(p[0], p[1], p[2]);
+#ifdef SCENE_H
+    if (vertexObjects)
+        position = glm::vec3(GlobalScene.GetObjectMatrix(vertexObjects[vertex]) * glm::vec4(position, 1.0f));
+#endif
+    return position;
+}
+
+void BVH::UpdateTriangle(int i)
+{
+    glm::vec3 v0 = Position(triangleIndices[i].x);
+    vertices[3 * i] = v0;
+    vertices[3 * i + 1] = Position(triangleIndices[i].y) - v0;
+    vertices[3 * i + 2] = Position(triangleIndices[i].z) - v0;
+}
+
+void BVH::UpdateLeaf(BVHNode &node)
+{
+    BVHBounds box;
+    for (int i = node.leftFirst; i < node.leftFirst + node.count; i++)
+    {
+        glm::vec3 v0 = vertices[3 * i];
+        box.Grow(v0);
+        box.Grow(v0 + vertices[3 * i + 1]);
+        box.Grow(v0 + vertices[3 * i + 2]);
+    }
+    node.min = box.min;
+    node.max = box.max;
+}
+
+void BVH::Refit()
+{
+    if (triangles.empty())
+        return;
+#ifdef OBJECT_H
+    bool sceneChanged = false;
+#ifdef SCENE_H
+    sceneChanged = vertexObjects && sceneVersion != GlobalScene.GetVersion();
+    sceneVersion = GlobalScene.GetVersion();
+#endif
+    if (version == GlobalDataVersion && !sceneChanged)
+        return;
+    unsigned int seen = version;
+    ParallelFor(0, triangles.size(), BVHParallelThreshold, [&](int begin, int end)
+                {
+                    for (int i = begin; i < end; i++)
+                        if (sceneChanged || objects[i] == -1 || GlobalObejcts[objects[i]]->GetVersion() > seen)
+                            UpdateTriangle(i); });
+    version = GlobalDataVersion;
+#else
+    ParallelFor(0, triangles.size(), BVHParallelThreshold, [&](int begin, int end)
+                {
+                    for (int i = begin; i < end; i++)
+                        UpdateTriangle(i); });
+#endif
+
+    // En : Leaves are refitted in parallel. Children always follow their parent, so a reverse pass fixes the inner nodes.
+    // Tr : Yapraklar paralel olarak uydurulur. Çocuklar her zaman ebeveynlerinden sonra gelir, bu yüzden ters bir geçiş iç düğümleri düzeltir.
+    ParallelFor(0, nodes.size(), BVHParallelThreshold, [&](int begin, int end)
+                {
+                    for (int i = begin; i < end; i++)
+                        if (nodes[i].count)
+                            UpdateLeaf(nodes[i]); });
+    for (int i = nodes.size() - 1; i >= 0; i--)
+    {
+        BVHNode &node = nodes[i];
+        if (node.count)
+            continue;
+        const BVHNode &left = nodes[node.leftFirst], &right = nodes[node.leftFirst + 1];
+        node.min = glm::min(left.min, right.min);
+        node.max = glm::max(left.max, right.max);
+    }
+}
+
+// En : Slab test. Returns the entry distance, or FLT_MAX on a miss.
+// Tr : Levha testi. Giriş mesafesini, ıskalamada ise FLT_MAX döndürür.
+inline float IntersectBox(const BVHNode &node, const glm::vec3 &origin, const glm::vec3 &inverse, float tMax)
+{
+    glm::vec3 t1 = (node.min - origin) * inverse, t2 = (node.max - origin) * inverse;
+    glm::vec3 tNear = glm::min(t1, t2), tFar = glm::max(t1, t2);
+    float entry = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+    float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, tMax));
+    return entry <= exit ? entry : FLT_MAX;
+}
+
+bool BVH::Intersect(const Ray &ray, RayHit &hit) const
+{
+    hit = RayHit();
+    if (triangles.empty())
+        return false;
+    glm::vec3 inverse = 1.0f / ray.direction;
+    float tMax = ray.tMax;
+    int stack[BVHStackSize], pointer = 0;
+    int current = 0;
+    if (IntersectBox(nodes[0], ray.origin, inverse, tMax) == FLT_MAX)
+        return false;
+    while (true)
+    {
+        const BVHNode &node = nodes[current];
+        if (node.count)
+        {
+            // En : Möller–Trumbore intersection against every triangle in the leaf.
+            // Tr : Yapraktaki her üçgen ile Möller–Trumbore kesişimi.
+            for (int i = node.leftFirst; i < node.leftFirst + node.count; i++)
+            {
+                const glm::vec3 &v0 = vertices[3 * i], &e1 = vertices[3 * i + 1], &e2 = vertices[3 * i + 2];
+                glm::vec3 p = glm::cross(ray.direction, e2);
+                float determinant = glm::dot(e1, p);
+                if (std::abs(determinant) < 1e-12f)
+                    continue;
+                float inverseDeterminant = 1.0f / determinant;
+                glm::vec3 s = ray.origin - v0;
+                float u = glm::dot(s, p) * inverseDeterminant;
+                if (u < 0 || u > 1)
+                    continue;
+                glm::vec3 q = glm::cross(s, e1);
+                float v = glm::dot(ray.direction, q) * inverseDeterminant;
+                if (v < 0 || u + v > 1)
+                    continue;
+                float t = glm::dot(e2, q) * inverseDeterminant;
+                if (t > 0 && t < tMax)
+                {
+                    tMax = t;
+                    hit.t = t;
+                    hit.triangle = triangles[i];
+                    hit.object = objects[i];
+                    hit.barycentric = glm::vec2(u, v);
+                }
+            }
+            if (!pointer)
+                break;
+            current = stack[--pointer];
+            continue;
+        }
+
+        // En : Visit the nearer child first and keep the other one on the stack.
+        // Tr : Önce yakın çocuğu ziyaret et ve diğerini yığında tut.
+        int left = node.leftFirst, right = left + 1;
+        float tLeft = IntersectBox(nodes[left], ray.origin, inverse, tMax),
+              tRight = IntersectBox(nodes[right], ray.origin, inverse, tMax);
+        if (tLeft > tRight)
+        {
+            std::swap(tLeft, tRight);
+            std::swap(left, right);
+        }
+        if (tLeft == FLT_MAX)
+        {
+            if (!pointer)
+                break;
+            current = stack[--pointer];
+            continue;
+        }
+        current = left;
+        if (tRight != FLT_MAX)
+            stack[pointer++] = right;
+    }
+    return hit.triangle != -1;
+}
+
+void BVH::IntersectPacket(const Ray *rays, RayHit *hits) const
+{
+#ifdef BVH_SSE
+    for (int i = 0; i < 4; i++)
+        hits[i] = RayHit();
+    if (triangles.empty())
+        return;
+
+    // En : Four rays are kept as structure of arrays, one lane per ray.
+    // Tr : Dört ışın, ışın başına bir şerit olacak şekilde dizi yapısı olarak tutulur.
+    __m128 ox = _mm_setr_ps(rays[0].origin.x, rays[1].origin.x, rays[2].origin.x, rays[3].origin.x),
+           oy = _mm_setr_ps(rays[0].origin.y, rays[1].origin.y, rays[2].origin.y, rays[3].origin.y),
+           oz = _mm_setr_ps(rays[0].origin.z, rays[1].origin.z, rays[2].origin.z, rays[3].origin.z),
+           dx = _mm_setr_ps(rays[0].direction.x, rays[1].direction.x, rays[2].direction.x, rays[3].direction.x),
+           dy = _mm_setr_ps(rays[0].direction.y, rays[1].direction.y, rays[2].direction.y, rays[3].direction.y),
+           dz = _mm_setr_ps(rays[0].direction.z, rays[1].direction.z, rays[2].direction.z, rays[3].direction.z),
+           tMax = _mm_setr_ps(rays[0].tMax, rays[1].tMax, rays[2].tMax, rays[3].tMax);
+    __m128 one = _mm_set1_ps(1.0f), zero = _mm_setzero_ps();
+    __m128 ix = _mm_div_ps(one, dx), iy = _mm_div_ps(one, dy), iz = _mm_div_ps(one, dz);
+    __m128 hitU = zero, hitV = zero;
+
+    int stack[BVHStackSize], pointer = 0;
+    stack[pointer++] = 0;
+    while (pointer)
+    {
+        const BVHNode &node = nodes[stack[--pointer]];
+
+        __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.min.x), ox), ix), t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.max.x), ox), ix);
+        __m128 entry = _mm_min_ps(t1, t2), exit = _mm_max_ps(t1, t2);
+        t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.min.y), oy), iy), t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.max.y), oy), iy);
+        entry = _mm_max_ps(entry, _mm_min_ps(t1, t2)), exit = _mm_min_ps(exit, _mm_max_ps(t1, t2));
+        t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.min.z), oz), iz), t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.max.z), oz), iz);
+        entry = _mm_max_ps(_mm_max_ps(entry, _mm_min_ps(t1, t2)), zero), exit = _mm_min_ps(_mm_min_ps(exit, _mm_max_ps(t1, t2)), tMax);
+        if (!_mm_movemask_ps(_mm_cmple_ps(entry, exit)))
+            continue;
+
+        if (!node.count)
+        {
+            stack[pointer++] = node.leftFirst + 1;
+            stack[pointer++] = node.leftFirst;
+            continue;
+        }
+
+        for (int i = node.leftFirst; i < node.leftFirst + node.count; i++)
+        {
+            const glm::vec3 &v0 = vertices[3 * i], &e1 = vertices[3 * i + 1], &e2 = vertices[3 * i + 2];
+            __m128 e1x = _mm_set1_ps(e1.x), e1y = _mm_set1_ps(e1.y), e1z = _mm_set1_ps(e1.z),
+                   e2x = _mm_set1_ps(e2.x), e2y = _mm_set1_ps(e2.y), e2z = _mm_set1_ps(e2.z);
+            // En : p = cross(direction, e2), determinant = dot(e1, p)
+            // Tr : p = cross(yön, e2), determinant = dot(e1, p)
+            __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y)),
+                   py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z)),
+                   pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+            __m128 determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+            __m128 inverseDeterminant = _mm_div_ps(one, determinant);
+            __m128 sx = _mm_sub_ps(ox, _mm_set1_ps(v0.x)), sy = _mm_sub_ps(oy, _mm_set1_ps(v0.y)), sz = _mm_sub_ps(oz, _mm_set1_ps(v0.z));
+            __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inverseDeterminant);
+            // En : q = cross(s, e1)
+            // Tr : q = cross(s, e1)
+            __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y)),
+                   qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z)),
+                   qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+            __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverseDeterminant);
+            __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverseDeterminant);
+
+            __m128 mask = _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero));
+            mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_add_ps(u, v), one));
+            mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpgt_ps(t, zero), _mm_cmplt_ps(t, tMax)));
+            int bits = _mm_movemask_ps(mask);
+            if (!bits)
+                continue;
+            tMax = _mm_or_ps(_mm_and_ps(mask, t), _mm_andnot_ps(mask, tMax));
+            hitU = _mm_or_ps(_mm_and_ps(mask, u), _mm_andnot_ps(mask, hitU));
+            hitV = _mm_or_ps(_mm_and_ps(mask, v), _mm_andnot_ps(mask, hitV));
+            for (int lane = 0; lane < 4; lane++)
+                if (bits & (1 << lane))
+                {
+                    hits[lane].triangle = triangles[i];
+                    hits[lane].object = objects[i];
+                }
+        }
+    }
+
+    float t[4], u[4], v[4];
+    _mm_storeu_ps(t, tMax);
+    _mm_storeu_ps(u, hitU);
+    _mm_storeu_ps(v, hitV);
+    for (int lane = 0; lane < 4; lane++)
+        if (hits[lane].triangle != -1)
+        {
+            hits[lane].t = t[lane];
+            hits[lane].barycentric = glm::vec2(u[lane], v[lane]);
+        }
+#else
+    for (int i = 0; i < 4; i++)
+        Intersect(rays[i], hits[i]);
+#endif
+}
+
+void BVH::Intersect(const Ray *rays, int count, RayHit *hits) const
+{
+    int packets = count / 4;
+    ParallelFor(0, packets, 256, [&](int begin, int end)
+                {
+                    for (int i = begin; i < end; i++)
+                        IntersectPacket(rays + 4 * i, hits + 4 * i); });
+    for (int i = 4 * packets; i < count; i++)
+        Intersect(rays[i], hits[i]);
+}
+
+int BVH::GetTriangleCount() const
+{
+    return triangles.size();
+}
+
+int BVH::GetNodeCount() const
+{
+    return nodes.size();
+}
+
+Ray ScreenRay(glm::vec2 cursor, glm::ivec2 windowSize)
+{
+    // En : The mesh shader has no camera, so positions are already in normalized device coordinates.
+    // Tr : Mesh gölgelendiricisinin kamerası yok, bu yüzden pozisyonlar zaten normalleştirilmiş cihaz koordinatlarındadır.
+    Ray ray;
+    ray.origin = glm::vec3(2.0f * cursor.x / windowSize.x - 1.0f, 1.0f - 2.0f * cursor.y / windowSize.y, -1.0f);
+    ray.direction = glm::vec3(0.0f, 0.0f, 1.0f);
+    ray.tMax = 2.0f;
+    return ray;
+}
@@ -0,0 +1,79 @@
+// En : This file contains the class and function prototypes for the bounding volume hierarchy used by ray queries.
+// Tr : Bu dosya, ışın sorgularında kullanılan sınırlayıcı hacim hiyerarşisi için sınıf ve fonksiyon prototiplerini içerir.
+#include <glm/glm.hpp>
+#include <vector>
+#include <cfloat>
+#ifndef BVH_H
+#define BVH_H
+
+// En : A ray and the hit record returned by the queries. Triangle is the index of the triangle in the index data (index / 3).
+// Tr : Bir ışın ve sorguların döndürdüğü isabet kaydı. Triangle, üçgenin index verisindeki sırasıdır (index / 3).
+struct Ray
+{
+    glm::vec3 origin;
+    glm::vec3 direction;
+    float tMax = FLT_MAX;
+};
+struct RayHit
+{
+    int object = -1;
+    int triangle = -1;
+    float t = FLT_MAX;
+    glm::vec2 barycentric = glm::vec2(0.0f);
+};
+
+// En : A node is a leaf if count is not zero. For leaves leftFirst is the first triangle, otherwise it is the left child and the right child follows it.
+// Tr : count sıfır değilse düğüm bir yapraktır. Yapraklarda leftFirst ilk üçgendir, aksi halde sol çocuktur ve sağ çocuk onu takip eder.
+struct BVHNode
+{
+    glm::vec3 min;
+    int leftFirst;
+    glm::vec3 max;
+    int count;
+};
+
+// En : Class declaration for the triangle BVH. It is built with binned SAH and refitted when objects move.
+// Tr : Üçgen BVH için sınıf bildirimi. Kutulanmış SAH ile oluşturulur ve nesneler hareket ettiğinde yeniden uydurulur.
+class BVH
+{
+private:
+    std::vector<BVHNode> nodes;
+    // En : Per triangle data in leaf order. Vertices are stored as the first vertex and two edges.
+    // Tr : Yaprak sırasında üçgen başına veriler. Köşeler ilk köşe ve iki kenar olarak saklanır.
+    std::vector<int> triangles;
+    std::vector<int> objects;
+    std::vector<glm::ivec3> triangleIndices;
+    std::vector<glm::vec3> vertices;
+    // En : Positions are read from this buffer while building and refitting, so it must outlive the BVH.
+    // Tr : Pozisyonlar oluşturma ve yeniden uydurma sırasında bu tampondan okunur, bu yüzden BVH'den uzun yaşamalıdır.
+    const float *positions = nullptr;
+    int stride = 3;
+    // En : Object index of every vertex. When given, positions are moved by the object matrices of the scene graph.
+    // Tr : Her köşenin nesne indisi. Verildiğinde pozisyonlar sahne grafiğinin nesne matrisleri ile taşınır.
+    const int *vertexObjects = nullptr;
+    unsigned int version = 0, sceneVersion = 0;
+    glm::vec3 Position(int vertex) const;
+    void UpdateTriangle(int i);
+    void UpdateLeaf(BVHNode &node);
+
+public:
+    // En : Build the hierarchy over the triangles of the index data. Stride is the float count between two positions.
+    // Tr : Hiyerarşiyi index verisindeki üçgenler üzerinde oluştur. Stride, iki pozisyon arasındaki float sayısıdır.
+    void Build(const float *positions, int stride, const std::vector<int> &index, const int *vertexObjects = nullptr);
+    // En : Recompute the bounds of the triangles whose objects changed since the last build or refit. A moved group refits every triangle.
+    // Tr : Son oluşturma veya uydurmadan beri nesnesi değişen üçgenlerin sınırlarını yeniden hesapla. Taşınan bir grup tüm üçgenleri yeniden uydurur.
+    void Refit();
+    // En : Intersect a single ray, four rays as a SIMD packet, or a batch of rays on all cores.
+    // Tr : Tek bir ışını, SIMD paketi olarak dört ışını veya bir ışın grubunu tüm çekirdeklerde kesiştir.
+    bool Intersect(const Ray &ray, RayHit &hit) const;
+    void IntersectPacket(const Ray *rays, RayHit *hits) const;
+    void Intersect(const Ray *rays, int count, RayHit *hits) const;
+    int GetTriangleCount() const;
+    int GetNodeCount() const;
+};
+
+// En : Create the ray under a cursor position given in window coordinates.
+// Tr : Pencere koordinatlarında verilen imleç pozisyonunun altındaki ışını oluştur.
+Ray ScreenRay(glm::vec2 cursor, glm::ivec2 windowSize);
+
+#endif
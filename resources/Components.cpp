@@ -0,0 +1,82 @@
+// En : Definitions of Components.h file.
+// Tr : Components.h dosyasının tanımlamaları.
+#include "Components.h"
+#include <algorithm>
+#include <cmath>
+
+void ComponentStore::MarkPositions(int begin, int end)
+{
+    dirtyPositions = dirtyPositions.x == dirtyPositions.y ? glm::ivec2(begin, end) : glm::ivec2(std::min(dirtyPositions.x, begin), std::max(dirtyPositions.y, end));
+}
+
+void ComponentStore::MarkNormals(int begin, int end)
+{
+    if (normals.empty())
+        return;
+    dirtyNormals = dirtyNormals.x == dirtyNormals.y ? glm::ivec2(begin, end) : glm::ivec2(std::min(dirtyNormals.x, begin), std::max(dirtyNormals.y, end));
+}
+
+glm::ivec2 ComponentStore::TakeDirtyPositions()
+{
+    glm::ivec2 range = dirtyPositions;
+    dirtyPositions = glm::ivec2(0);
+    return range;
+}
+
+glm::ivec2 ComponentStore::TakeDirtyNormals()
+{
+    glm::ivec2 range = dirtyNormals;
+    dirtyNormals = glm::ivec2(0);
+    return range;
+}
+
+glm::vec3 Centroid(const glm::vec3 *positions, int count)
+{
+    if (!count)
+        return glm::vec3(0.0f);
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+    for (int i = 0; i < count; i++)
+    {
+        x += positions[i].x;
+        y += positions[i].y;
+        z += positions[i].z;
+    }
+    return glm::vec3(x, y, z) / (float)count;
+}
+
+void TranslatePositions(glm::vec3 *positions, int count, glm::vec3 offset)
+{
+    // En : The array is walked as plain floats, so the loop has no gathers and can be vectorized.
+    // Tr : Dizi düz float olarak gezilir, böylece döngüde toplama yoktur ve vektörleştirilebilir.
+    float *values = &positions[0].x;
+    const float add[3] = {offset.x, offset.y, offset.z};
+    for (int i = 0; i < count * 3; i++)
+        values[i] += add[i % 3];
+}
+
+void TransformPositions(glm::vec3 *positions, int count, const glm::mat3 &linear, glm::vec3 center)
+{
+    for (int i = 0; i < count; i++)
+        positions[i] = linear * (positions[i] - center) + center;
+}
+
+void TransformNormals(glm::vec3 *normals, int count, const glm::mat3 &linear)
+{
+    for (int i = 0; i < count; i++)
+        normals[i] = glm::normalize(linear * normals[i]);
+}
+
+glm::mat3 EulerRotation(glm::vec3 degrees)
+{
+    // En : Closed form of Rz * Ry * Rx, six trigonometric calls instead of rotating every basis vector three times.
+    // Tr : Rz * Ry * Rx'in kapalı formu, her taban vektörünü üç kez döndürmek yerine altı trigonometrik çağrı.
+    glm::vec3 angles = glm::radians(degrees);
+    float sx = std::sin(angles.x), cx = std::cos(angles.x);
+    float sy = std::sin(angles.y), cy = std::cos(angles.y);
+    float sz = std::sin(angles.z), cz = std::cos(angles.z);
+    glm::mat3 rotation;
+    rotation[0] = glm::vec3(cz * cy, sz * cy, -sy);
+    rotation[1] = glm::vec3(cz * sy * sx - sz * cx, sz * sy * sx + cz * cx, cy * sx);
+    rotation[2] = glm::vec3(cz * sy * cx + sz * sx, sz * sy * cx - cz * sx, cy * cx);
+    return rotation;
+}
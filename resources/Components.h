@@ -0,0 +1,36 @@
+// En : This file contains the class and function prototypes for the component store. Every vertex attribute lives in its own contiguous, aligned array.
+// Tr : Bu dosya, bileşen deposu için sınıf ve fonksiyon prototiplerini içerir. Her köşe niteliği kendi bitişik ve hizalı dizisinde tutulur.
+#include <glm/glm.hpp>
+#include <vector>
+#include "Analyze.h"
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+// En : Vertex attributes and indices of the scene. Normals, uvs and objects are empty when the scene has none. Chunks are appended through VertexStreams::Append, so the first one is taken over without a copy.
+// Tr : Sahnenin köşe nitelikleri ve indisleri. Sahnede yoksa normaller, uv'ler ve nesneler boştur. Parçalar VertexStreams::Append ile eklenir, böylece ilki kopyalanmadan devralınır.
+class ComponentStore : public VertexStreams
+{
+private:
+    glm::ivec2 dirtyPositions = glm::ivec2(0), dirtyNormals = glm::ivec2(0);
+
+public:
+    // En : Vertex ranges changed since the last upload. Colors and uvs are never changed by transforms.
+    // Tr : Son yüklemeden beri değişen köşe aralıkları. Renkler ve uv'ler dönüşümlerle asla değişmez.
+    void MarkPositions(int begin, int end);
+    void MarkNormals(int begin, int end);
+    glm::ivec2 TakeDirtyPositions();
+    glm::ivec2 TakeDirtyNormals();
+};
+
+// En : Transform passes over contiguous attribute arrays.
+// Tr : Bitişik nitelik dizileri üzerinde dönüşüm geçişleri.
+glm::vec3 Centroid(const glm::vec3 *positions, int count);
+void TranslatePositions(glm::vec3 *positions, int count, glm::vec3 offset);
+void TransformPositions(glm::vec3 *positions, int count, const glm::mat3 &linear, glm::vec3 center);
+void TransformNormals(glm::vec3 *normals, int count, const glm::mat3 &linear);
+
+// En : The rotation that applies rotateX, rotateY and rotateZ in this order. Angles are in degrees.
+// Tr : rotateX, rotateY ve rotateZ'yi bu sırada uygulayan dönme. Açılar derece cinsindendir.
+glm::mat3 EulerRotation(glm::vec3 degrees);
+
+#endif
@@ -0,0 +1,389 @@
+// En : Definitions of Expression.h file.
+// Tr : Expression.h dosyasının tanımlamaları.
+#include "Expression.h"
+#include "Jobs.h"
+#include <charconv>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const int ExpressionBlock = 256;
+const int ExpressionGrain = 64;
+
+// En : Operands are tagged while parsing, because the first temporary register is known only after every constant is found.
+// Tr : İşlenenler ayrıştırılırken etiketlenir, çünkü ilk geçici yazmaç ancak her sabit bulunduktan sonra bilinir.
+const int ExpressionConstantTag = 1 << 20;
+const int ExpressionTemporaryTag = 1 << 21;
+
+void ColorExpression::Push(int operand)
+{
+    operands.push_back(operand);
+}
+
+bool ColorExpression::PushConstant(glm::vec3 value)
+{
+    std::vector<glm::vec3>::iterator found = std::find(constants.begin(), constants.end(), value);
+    if (found == constants.end())
+        found = constants.insert(constants.end(), value);
+    Push(ExpressionConstantTag + (found - constants.begin()));
+    return true;
+}
+
+void ColorExpression::Apply(Operation operation, int arity)
+{
+    int arguments[3] = {0, 0, 0};
+    for (int i = arity - 1; i >= 0; i--)
+    {
+        arguments[i] = operands.back();
+        operands.pop_back();
+        if (arguments[i] >= ExpressionTemporaryTag)
+            temporaries--;
+    }
+    int target = ExpressionTemporaryTag + temporaries++;
+    maxTemporaries = std::max(maxTemporaries, temporaries);
+    code.push_back({operation, target, arguments[0], arguments[1], arguments[2]});
+    operands.push_back(target);
+}
+
+void ColorExpression::SkipSpaces()
+{
+    while (cursor < end && std::isspace((unsigned char)*cursor))
+        cursor++;
+}
+
+bool ColorExpression::Fail(const std::string &message)
+{
+    if (error.empty())
+        error = message;
+    return false;
+}
+
+bool ColorExpression::Compile(const std::string &text, const char *variables)
+{
+    this->variables = variables;
+    code.clear();
+    constants.clear();
+    operands.clear();
+    error.clear();
+    temporaries = maxTemporaries = 0;
+    axes[0] = axes[1] = axes[2] = false;
+    cursor = text.data();
+    end = text.data() + text.size();
+    bool valid = ParseSum();
+    SkipSpaces();
+    if (valid && cursor != end)
+        valid = Fail("unexpected '" + std::string(1, *cursor) + "'");
+    cursor = end = this->variables = nullptr;
+    if (!valid)
+    {
+        code.clear();
+        return false;
+    }
+
+    // En : Resolve the tags into the final register layout.
+    // Tr : Etiketleri son yazmaç düzenine çöz.
+    int firstTemporary = 3 + constants.size();
+    auto resolve = [&](int operand)
+    {
+        if (operand >= ExpressionTemporaryTag)
+            return firstTemporary + operand - ExpressionTemporaryTag;
+        if (operand >= ExpressionConstantTag)
+            return 3 + operand - ExpressionConstantTag;
+        return operand;
+    };
+    for (Instruction &instruction : code)
+    {
+        instruction.target = resolve(instruction.target);
+        instruction.a = resolve(instruction.a);
+        instruction.b = resolve(instruction.b);
+        instruction.c = resolve(instruction.c);
+    }
+    result = resolve(operands.back());
+    registerCount = firstTemporary + maxTemporaries;
+    operands.clear();
+    return true;
+}
+
+const std::string &ColorExpression::GetError() const
+{
+    return error;
+}
+
+bool ColorExpression::ParseSum()
+{
+    if (!ParseProduct())
+        return false;
+    while (true)
+    {
+        SkipSpaces();
+        if (cursor == end || (*cursor != '+' && *cursor != '-'))
+            return true;
+        Operation operation = *cursor++ == '+' ? Operation::Add : Operation::Subtract;
+        if (!ParseProduct())
+            return false;
+        Apply(operation, 2);
+    }
+}
+
+bool ColorExpression::ParseProduct()
+{
+    if (!ParseUnary())
+        return false;
+    while (true)
+    {
+        SkipSpaces();
+        if (cursor == end || (*cursor != '*' && *cursor != '/'))
+            return true;
+        Operation operation = *cursor++ == '*' ? Operation::Multiply : Operation::Divide;
+        if (!ParseUnary())
+            return false;
+        Apply(operation, 2);
+    }
+}
+
+bool ColorExpression::ParseUnary()
+{
+    SkipSpaces();
+    if (cursor != end && *cursor == '-')
+    {
+        cursor++;
+        if (!ParseUnary())
+            return false;
+        Apply(Operation::Negate, 1);
+        return true;
+    }
+    if (cursor != end && *cursor == '+')
+        cursor++;
+    return ParsePrimary();
+}
+
+bool ColorExpression::ParsePrimary()
+{
+    SkipSpaces();
+    if (cursor == end)
+        return Fail("unexpected end");
+
+    // En : Parenthesized expression.
+    // Tr : Parantez içindeki ifade.
+    if (*cursor == '(')
+    {
+        cursor++;
+        if (!ParseSum())
+            return false;
+        SkipSpaces();
+        if (cursor == end || *cursor != ')')
+            return Fail("missing ')'");
+        cursor++;
+        return true;
+    }
+
+    // En : Hex color, the same digits as the color attribute.
+    // Tr : Onaltılık renk, color niteliği ile aynı basamaklar.
+    if (*cursor == '#')
+    {
+        unsigned int value = 0;
+        std::from_chars_result result = std::from_chars(cursor + 1, end, value, 16);
+        if (result.ec != std::errc() || result.ptr - cursor != 7)
+            return Fail("invalid color");
+        cursor = result.ptr;
+        return PushConstant(glm::vec3((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF) / 255.0f);
+    }
+
+    if (std::isdigit((unsigned char)*cursor) || *cursor == '.')
+    {
+        float value;
+        std::from_chars_result result = std::from_chars(cursor, end, value);
+        if (result.ec != std::errc())
+            return Fail("invalid number");
+        cursor = result.ptr;
+        return PushConstant(glm::vec3(value));
+    }
+
+    const char *begin = cursor;
+    while (cursor < end && std::isalpha((unsigned char)*cursor))
+        cursor++;
+    std::string name(begin, cursor);
+    if (name.empty())
+        return Fail("unexpected '" + std::string(1, *cursor) + "'");
+    if (name.size() == 1 && std::strchr(variables, name[0]))
+    {
+        int axis = std::strchr(variables, name[0]) - variables;
+        axes[axis] = true;
+        Push(axis);
+        return true;
+    }
+    if (name == "pi")
+        return PushConstant(glm::vec3(3.14159265358979323846f));
+
+    struct Function
+    {
+        const char *name;
+        Operation operation;
+        int arity;
+    };
+    const Function functions[] = {
+        {"min", Operation::Min, 2}, {"max", Operation::Max, 2}, {"pow", Operation::Pow, 2}, {"step", Operation::Step, 2}, {"abs", Operation::Abs, 1}, {"sin", Operation::Sin, 1}, {"cos", Operation::Cos, 1}, {"floor", Operation::Floor, 1}, {"fract", Operation::Fract, 1}, {"sqrt", Operation::Sqrt, 1}, {"length", Operation::Length, 1}, {"mix", Operation::Mix, 3}, {"clamp", Operation::Clamp, 3}, {"smoothstep", Operation::Smoothstep, 3}, {"vec", Operation::Vec, 3}};
+    const Function *function = std::find_if(std::begin(functions), std::end(functions), [&](const Function &f)
+                                            { return name == f.name; });
+    if (function == std::end(functions))
+        return Fail("unknown name '" + name + "'");
+    SkipSpaces();
+    if (cursor == end || *cursor != '(')
+        return Fail("missing '(' after " + name);
+    cursor++;
+    for (int i = 0; i < function->arity; i++)
+    {
+        if (!ParseSum())
+            return false;
+        SkipSpaces();
+        char expected = i + 1 < function->arity ? ',' : ')';
+        if (cursor == end || *cursor != expected)
+            return Fail(name + " takes " + std::to_string(function->arity) + " arguments");
+        cursor++;
+    }
+    Apply(function->operation, function->arity);
+    return true;
+}
+
+void ColorExpression::EvaluateBlock(const glm::vec3 *positions, glm::vec3 *output, int count, float *registers) const
+{
+    // En : Registers hold the three channels of a block one after another, so the channel-wise instructions run over 3 * ExpressionBlock floats in one loop.
+    // Tr : Yazmaçlar bir bloğun üç kanalını art arda tutar, böylece kanal bazlı komutlar tek döngüde 3 * ExpressionBlock float üzerinde çalışır.
+    const int n = 3 * ExpressionBlock;
+    for (int axis = 0; axis < 3; axis++)
+        if (axes[axis])
+        {
+            float *r = registers + axis * n;
+            for (int i = 0; i < count; i++)
+                r[i] = positions[i][axis];
+            std::memcpy(r + ExpressionBlock, r, ExpressionBlock * sizeof(float));
+            std::memcpy(r + 2 * ExpressionBlock, r, ExpressionBlock * sizeof(float));
+        }
+    for (const Instruction &instruction : code)
+    {
+        float *t = registers + instruction.target * n;
+        const float *a = registers + instruction.a * n, *b = registers + instruction.b * n, *c = registers + instruction.c * n;
+        switch (instruction.operation)
+        {
+        case Operation::Add:
+            for (int i = 0; i < n; i++)
+                t[i] = a[i] + b[i];
+            break;
+        case Operation::Subtract:
+            for (int i = 0; i < n; i++)
+                t[i] = a[i] - b[i];
+            break;
+        case Operation::Multiply:
+            for (int i = 0; i < n; i++)
+                t[i] = a[i] * b[i];
+            break;
+        case Operation::Divide:
+            for (int i = 0; i < n; i++)
+                t[i] = a[i] / b[i];
+            break;
+        case Operation::Negate:
+            for (int i = 0; i < n; i++)
+                t[i] = -a[i];
+            break;
+        case Operation::Min:
+            for (int i = 0; i < n; i++)
+                t[i] = std::min(a[i], b[i]);
+            break;
+        case Operation::Max:
+            for (int i = 0; i < n; i++)
+                t[i] = std::max(a[i], b[i]);
+            break;
+        case Operation::Pow:
+            for (int i = 0; i < n; i++)
+                t[i] = std::pow(a[i], b[i]);
+            break;
+        case Operation::Step:
+            for (int i = 0; i < n; i++)
+                t[i] = b[i] < a[i] ? 0.0f : 1.0f;
+            break;
+        case Operation::Abs:
+            for (int i = 0; i < n; i++)
+                t[i] = std::abs(a[i]);
+            break;
+        case Operation::Sin:
+            for (int i = 0; i < n; i++)
+                t[i] = std::sin(a[i]);
+            break;
+        case Operation::Cos:
+            for (int i = 0; i < n; i++)
+                t[i] = std::cos(a[i]);
+            break;
+        case Operation::Floor:
+            for (int i = 0; i < n; i++)
+                t[i] = std::floor(a[i]);
+            break;
+        case Operation::Fract:
+            for (int i = 0; i < n; i++)
+                t[i] = a[i] - std::floor(a[i]);
+            break;
+        case Operation::Sqrt:
+            for (int i = 0; i < n; i++)
+                t[i] = std::sqrt(a[i]);
+            break;
+        case Operation::Length:
+            for (int i = 0; i < ExpressionBlock; i++)
+            {
+                float length = std::sqrt(a[i] * a[i] + a[i + ExpressionBlock] * a[i + ExpressionBlock] + a[i + 2 * ExpressionBlock] * a[i + 2 * ExpressionBlock]);
+                t[i] = t[i + ExpressionBlock] = t[i + 2 * ExpressionBlock] = length;
+            }
+            break;
+        case Operation::Mix:
+            for (int i = 0; i < n; i++)
+                t[i] = a[i] + (b[i] - a[i]) * c[i];
+            break;
+        case Operation::Clamp:
+            for (int i = 0; i < n; i++)
+                t[i] = std::min(std::max(a[i], b[i]), c[i]);
+            break;
+        case Operation::Smoothstep:
+            for (int i = 0; i < n; i++)
+            {
+                float s = std::min(std::max((c[i] - a[i]) / (b[i] - a[i]), 0.0f), 1.0f);
+                t[i] = s * s * (3.0f - 2.0f * s);
+            }
+            break;
+        case Operation::Vec:
+            // En : The target may be one of the arguments, the last channel is written first so that no first channel is overwritten before it is read.
+            // Tr : Hedef argümanlardan biri olabilir, son kanal önce yazılır, böylece hiçbir ilk kanal okunmadan üzerine yazılmaz.
+            std::memmove(t + 2 * ExpressionBlock, c, ExpressionBlock * sizeof(float));
+            std::memmove(t + ExpressionBlock, b, ExpressionBlock * sizeof(float));
+            std::memmove(t, a, ExpressionBlock * sizeof(float));
+            break;
+        }
+    }
+    const float *r = registers + result * n;
+    for (int i = 0; i < count; i++)
+        output[i] = glm::vec3(r[i], r[i + ExpressionBlock], r[i + 2 * ExpressionBlock]);
+}
+
+void ColorExpression::Evaluate(const glm::vec3 *positions, glm::vec3 *output, int count) const
+{
+    if (!registerCount)
+    {
+        std::fill(output, output + count, glm::vec3(0.0f));
+        return;
+    }
+    int blocks = (count + ExpressionBlock - 1) / ExpressionBlock;
+    ParallelFor(0, blocks, ExpressionGrain, [&](int first, int last)
+                {
+                    // En : Zeroed once, so that the unused lanes of the last block never hold garbage. The constants are filled once for all the blocks of the chunk.
+                    // Tr : Bir kez sıfırlanır, böylece son bloğun kullanılmayan şeritleri asla çöp tutmaz. Sabitler parçanın tüm blokları için bir kez doldurulur.
+                    std::vector<float> registers(registerCount * 3 * ExpressionBlock, 0.0f);
+                    for (int k = 0; k < (int)constants.size(); k++)
+                        for (int channel = 0; channel < 3; channel++)
+                            std::fill_n(registers.begin() + ((3 + k) * 3 + channel) * ExpressionBlock, ExpressionBlock, constants[k][channel]);
+                    for (int block = first; block < last; block++)
+                    {
+                        int begin = block * ExpressionBlock;
+                        EvaluateBlock(positions + begin, output + begin, std::min(ExpressionBlock, count - begin), registers.data());
+                    }
+                });
+}
@@ -0,0 +1,78 @@
+// En : This file contains the class prototype for color expressions. An expression is compiled once into bytecode and evaluated over blocks of vertices on every core.
+// Tr : Bu dosya, renk ifadeleri için sınıf prototipini içerir. Bir ifade bir kez bayt koduna derlenir ve köşe blokları üzerinde her çekirdekte değerlendirilir.
+#include <glm/glm.hpp>
+#include <vector>
+#include <string>
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+// En : Class declaration for color expressions, e.g. "mix(#ff0000, #0000ff, y)". Every value is a color, numbers, pi and the position variables x, y, z are spread to all three channels.
+// Tr : Renk ifadeleri için sınıf bildirimi, örn. "mix(#ff0000, #0000ff, y)". Her değer bir renktir, sayılar, pi ve x, y, z pozisyon değişkenleri üç kanala da yayılır.
+// En : Operators are + - * / and unary minus. Functions are mix, clamp, smoothstep, step, min, max, pow, abs, sin, cos, floor, fract, sqrt, length and vec(r, g, b), which takes the first channel of its arguments.
+// Tr : Operatörler + - * / ve tekli eksidir. Fonksiyonlar mix, clamp, smoothstep, step, min, max, pow, abs, sin, cos, floor, fract, sqrt, length ve argümanlarının ilk kanalını alan vec(r, g, b)'dir.
+// En : Instructions run on a whole block at once, the registers are channel-major arrays, so every instruction is a plain loop the compiler can vectorize.
+// Tr : Komutlar bir bloğun tamamında bir kerede çalışır, yazmaçlar kanal öncelikli dizilerdir, böylece her komut derleyicinin vektörleştirebileceği düz bir döngüdür.
+class ColorExpression
+{
+private:
+    enum class Operation
+    {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Negate,
+        Min,
+        Max,
+        Pow,
+        Step,
+        Abs,
+        Sin,
+        Cos,
+        Floor,
+        Fract,
+        Sqrt,
+        Length,
+        Mix,
+        Clamp,
+        Smoothstep,
+        Vec
+    };
+    // En : Every instruction writes target from up to three operand registers. Registers 0-2 hold the position axes, then the constants, which are filled once per thread, then the temporaries, which are reused like a stack.
+    // Tr : Her komut en fazla üç işlenen yazmacından target yazmacına yazar. 0-2 yazmaçları pozisyon eksenlerini, ardından iş parçacığı başına bir kez doldurulan sabitleri, sonra yığın gibi yeniden kullanılan geçicileri tutar.
+    struct Instruction
+    {
+        Operation operation;
+        int target, a, b, c;
+    };
+    std::vector<Instruction> code;
+    std::vector<glm::vec3> constants;
+    int registerCount = 0, result = 0;
+    bool axes[3] = {false, false, false};
+    std::string error;
+
+    const char *cursor = nullptr, *end = nullptr, *variables = nullptr;
+    std::vector<int> operands;
+    int temporaries = 0, maxTemporaries = 0;
+    void Push(int operand);
+    bool PushConstant(glm::vec3 value);
+    void Apply(Operation operation, int arity);
+    void SkipSpaces();
+    bool Fail(const std::string &message);
+    bool ParseSum();
+    bool ParseProduct();
+    bool ParseUnary();
+    bool ParsePrimary();
+    void EvaluateBlock(const glm::vec3 *positions, glm::vec3 *output, int count, float *registers) const;
+
+public:
+    // En : Compile the text. variables names the three input channels, surfaces use "uv". Returns false and keeps the reason in GetError if the text is malformed.
+    // Tr : Metni derle. variables üç girdi kanalını adlandırır, yüzeyler "uv" kullanır. Metin hatalıysa false döndürür ve nedeni GetError içinde tutar.
+    bool Compile(const std::string &text, const char *variables = "xyz");
+    const std::string &GetError() const;
+    // En : Evaluate the expression for count vertices. Blocks of vertices are split across the cores. positions and output may be the same array.
+    // Tr : İfadeyi count köşe için değerlendir. Köşe blokları çekirdeklere bölünür. positions ve output aynı dizi olabilir.
+    void Evaluate(const glm::vec3 *positions, glm::vec3 *output, int count) const;
+};
+
+#endif
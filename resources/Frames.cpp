@@ -0,0 +1,135 @@
+// En : Definitions of Frames.h file.
+// Tr : Frames.h dosyasının tanımlamaları.
+#include "Frames.h"
+#include <GLFW/glfw3.h>
+#include <cstdio>
+
+const float FrameHistogram::Bounds[FrameHistogram::BucketCount - 1] = {1.0f, 2.0f, 4.0f, 8.0f, 12.0f, 16.7f, 25.0f, 33.3f, 50.0f, 100.0f, 250.0f};
+
+void FrameHistogram::Record(double seconds)
+{
+    double milliseconds = seconds * 1000.0;
+    int bucket = 0;
+    while (bucket < BucketCount - 1 && milliseconds > Bounds[bucket])
+        bucket++;
+    counts[bucket]++;
+    total++;
+    sum += milliseconds;
+    if (milliseconds > longest)
+        longest = milliseconds;
+}
+
+void FrameHistogram::Reset()
+{
+    *this = FrameHistogram();
+}
+
+int FrameHistogram::GetCount(int bucket) const
+{
+    return counts[bucket];
+}
+
+int FrameHistogram::GetTotal() const
+{
+    return total;
+}
+
+double FrameHistogram::GetAverage() const
+{
+    return total ? sum / total : 0.0;
+}
+
+double FrameHistogram::GetLongest() const
+{
+    return longest;
+}
+
+float FrameHistogram::Percentile(float fraction) const
+{
+    // En : The last bucket has no upper bound, the longest frame stands in for it.
+    // Tr : Son kovanın üst sınırı yoktur, onun yerine en uzun kare kullanılır.
+    int needed = (int)(fraction * total + 0.999f), seen = 0;
+    for (int bucket = 0; bucket < BucketCount - 1; bucket++)
+    {
+        seen += counts[bucket];
+        if (seen >= needed)
+            return Bounds[bucket];
+    }
+    return (float)longest;
+}
+
+void FrameScheduler::SetMode(RenderMode mode)
+{
+    this->mode = mode;
+    dirty = true;
+}
+
+RenderMode FrameScheduler::GetMode() const
+{
+    return mode;
+}
+
+void FrameScheduler::RequestRedraw()
+{
+    // En : A request from another thread wakes the event loop, otherwise it would only be seen after the wait times out.
+    // Tr : Başka bir iş parçacığından gelen istek olay döngüsünü uyandırır, aksi halde yalnızca bekleme zaman aşımına uğradıktan sonra görülürdü.
+    if (!dirty.exchange(true) && std::this_thread::get_id() != mainThread)
+        glfwPostEmptyEvent();
+}
+
+bool FrameScheduler::WaitForFrame(double timeout)
+{
+    if (mode == RenderMode::Continuous)
+    {
+        glfwPollEvents();
+        dirty = false;
+        return true;
+    }
+    // En : Events that arrived while the last frame was drawn are handled without sleeping, their callbacks may have requested the next frame.
+    // Tr : Son kare çizilirken gelen olaylar uyumadan işlenir, geri çağırmaları sonraki kareyi istemiş olabilir.
+    glfwPollEvents();
+    if (!dirty.load(std::memory_order_relaxed))
+        glfwWaitEventsTimeout(timeout);
+    if (dirty.exchange(false))
+        return true;
+    skipped++;
+    return false;
+}
+
+void FrameScheduler::BeginFrame()
+{
+    frameStart = glfwGetTime();
+}
+
+void FrameScheduler::EndFrame()
+{
+    histogram.Record(glfwGetTime() - frameStart);
+}
+
+const FrameHistogram &FrameScheduler::GetHistogram() const
+{
+    return histogram;
+}
+
+int FrameScheduler::GetSkippedFrames() const
+{
+    return skipped;
+}
+
+std::string FormatFrameHistogram(const FrameHistogram &histogram, bool buckets)
+{
+    char line[128];
+    std::snprintf(line, sizeof(line), "Frames %d  Avg %.2f ms  P50 %.1f ms  P95 %.1f ms  P99 %.1f ms  Max %.2f ms", histogram.GetTotal(), histogram.GetAverage(), histogram.Percentile(0.5f), histogram.Percentile(0.95f), histogram.Percentile(0.99f), histogram.GetLongest());
+    std::string result = line;
+    if (!buckets)
+        return result;
+    for (int bucket = 0; bucket < FrameHistogram::BucketCount; bucket++)
+    {
+        if (bucket < FrameHistogram::BucketCount - 1)
+            std::snprintf(line, sizeof(line), "\n  <= %6.1f ms: %d", FrameHistogram::Bounds[bucket], histogram.GetCount(bucket));
+        else
+            std::snprintf(line, sizeof(line), "\n   > %6.1f ms: %d", FrameHistogram::Bounds[bucket - 1], histogram.GetCount(bucket));
+        result += line;
+    }
+    return result;
+}
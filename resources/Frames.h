@@ -0,0 +1,81 @@
+// En : This file contains the class prototypes for frame scheduling. A frame is drawn only when something on the screen changed, idle windows sleep in the event queue instead of redrawing the same image.
+// Tr : Bu dosya, kare zamanlaması için sınıf prototiplerini içerir. Bir kare yalnızca ekrandaki bir şey değiştiğinde çizilir, boşta olan pencereler aynı görüntüyü yeniden çizmek yerine olay kuyruğunda uyur.
+#include <atomic>
+#include <string>
+#include <thread>
+#ifndef FRAMES_H
+#define FRAMES_H
+
+// En : Continuous draws every frame like a game loop, OnDemand draws only after a redraw was requested.
+// Tr : Continuous bir oyun döngüsü gibi her kareyi çizer, OnDemand yalnızca yeniden çizim istendikten sonra çizer.
+enum class RenderMode
+{
+    Continuous,
+    OnDemand
+};
+
+// En : Histogram of frame times. The buckets grow roughly geometrically, so both the fast frames and the hitches are readable.
+// Tr : Kare sürelerinin histogramı. Kovalar kabaca geometrik büyür, böylece hem hızlı kareler hem de takılmalar okunabilir.
+class FrameHistogram
+{
+public:
+    static const int BucketCount = 12;
+    // En : Upper bounds of the buckets in milliseconds. The last bucket holds everything slower.
+    // Tr : Kovaların milisaniye cinsinden üst sınırları. Son kova daha yavaş olan her şeyi tutar.
+    static const float Bounds[BucketCount - 1];
+
+private:
+    int counts[BucketCount] = {};
+    int total = 0;
+    double sum = 0, longest = 0;
+
+public:
+    void Record(double seconds);
+    void Reset();
+    int GetCount(int bucket) const;
+    int GetTotal() const;
+    double GetAverage() const;
+    double GetLongest() const;
+    // En : Upper bound in milliseconds of the bucket that holds the given fraction of the frames, e.g. 0.95.
+    // Tr : Karelerin verilen oranını, örn. 0.95, tutan kovanın milisaniye cinsinden üst sınırı.
+    float Percentile(float fraction) const;
+};
+
+// En : Class declaration for the frame scheduler. Anything that changes the image calls RequestRedraw, which may be called from any thread.
+// Tr : Kare zamanlayıcısı için sınıf bildirimi. Görüntüyü değiştiren her şey, herhangi bir iş parçacığından çağrılabilen RequestRedraw'u çağırır.
+class FrameScheduler
+{
+private:
+    RenderMode mode = RenderMode::OnDemand;
+    std::atomic<bool> dirty{true};
+    // En : The scheduler is created before main, on the thread that runs the event loop.
+    // Tr : Zamanlayıcı main'den önce, olay döngüsünü çalıştıran iş parçacığında oluşturulur.
+    std::thread::id mainThread = std::this_thread::get_id();
+    FrameHistogram histogram;
+    double frameStart = 0;
+    int skipped = 0;
+
+public:
+    void SetMode(RenderMode mode);
+    RenderMode GetMode() const;
+    void RequestRedraw();
+    // En : Process the window events and tell whether a frame must be drawn. In OnDemand mode the thread sleeps until an event arrives or timeout seconds pass.
+    // Tr : Pencere olaylarını işle ve bir karenin çizilmesi gerekip gerekmediğini söyle. OnDemand modunda iş parçacığı bir olay gelene veya timeout saniye geçene kadar uyur.
+    bool WaitForFrame(double timeout);
+    // En : Time a drawn frame from the start of its work until its buffers were swapped.
+    // Tr : Çizilen bir kareyi işinin başlangıcından tamponları değiştirilene kadar zamanla.
+    void BeginFrame();
+    void EndFrame();
+    const FrameHistogram &GetHistogram() const;
+    // En : Wake-ups that did not draw a frame.
+    // Tr : Kare çizmeyen uyanmalar.
+    int GetSkippedFrames() const;
+};
+
+FrameScheduler GlobalFrames;
+
+// En : One line summary for the overlay, or one line per bucket if buckets is set.
+// Tr : Kaplama için tek satırlık özet, buckets ayarlıysa kova başına bir satır.
+std::string FormatFrameHistogram(const FrameHistogram &histogram, bool buckets = false);
+
+#endif
@@ -0,0 +1,701 @@
+// En : Definitions of Import.h file.
+// Tr : Import.h dosyasının tanımlamaları.
+#include "Import.h"
+#include "Jobs.h"
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <initializer_list>
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string &path)
+{
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return;
+    file = handle;
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(handle, &length) || length.QuadPart == 0)
+        return;
+    mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+        return;
+    data = (const char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data)
+        size = (std::size_t)length.QuadPart;
+#else
+    descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+        return;
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size == 0)
+        return;
+    void *view = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (view == MAP_FAILED)
+        return;
+    // En : The whole file is read by the parsers, so the kernel can fetch it ahead.
+    // Tr : Dosyanın tamamı ayrıştırıcılar tarafından okunur, böylece çekirdek onu önceden getirebilir.
+    madvise(view, status.st_size, MADV_WILLNEED);
+    data = (const char *)view;
+    size = status.st_size;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (data)
+        UnmapViewOfFile(data);
+    if (mapping)
+        CloseHandle(mapping);
+    if (file)
+        CloseHandle(file);
+#else
+    if (data)
+        munmap((void *)data, size);
+    if (descriptor >= 0)
+        close(descriptor);
+#endif
+}
+
+bool MappedFile::IsOpen() const
+{
+    return data != nullptr;
+}
+
+const char *MappedFile::GetData() const
+{
+    return data;
+}
+
+std::size_t MappedFile::GetSize() const
+{
+    return size;
+}
+
+// En : Text helpers shared by the OBJ and ASCII PLY parsers. A line ends at '\n', '\r' is treated as a space.
+// Tr : OBJ ve ASCII PLY ayrıştırıcılarının paylaştığı metin yardımcıları. Bir satır '\n' ile biter, '\r' boşluk sayılır.
+const char *SkipSpaces(const char *p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        p++;
+    return p;
+}
+
+const char *NextLine(const char *p, const char *end)
+{
+    const char *newline = (const char *)std::memchr(p, '\n', end - p);
+    return newline ? newline + 1 : end;
+}
+
+template <typename T>
+bool ParseNumber(const char *&p, const char *end, T &value)
+{
+    p = SkipSpaces(p, end);
+    if (p < end && *p == '+')
+        p++;
+    std::from_chars_result result = std::from_chars(p, end, value);
+    if (result.ec != std::errc())
+        return false;
+    p = result.ptr;
+    return true;
+}
+
+// En : Split [begin, end) into about count pieces that start at the beginning of a line. Returns count + 1 boundaries.
+// Tr : [begin, end) aralığını bir satırın başında başlayan yaklaşık count parçaya böl. count + 1 sınır döndürür.
+std::vector<const char *> SplitLines(const char *begin, const char *end, int count)
+{
+    std::vector<const char *> bounds(1, begin);
+    std::size_t step = (end - begin) / std::max(count, 1) + 1;
+    for (int i = 1; i < count; i++)
+    {
+        if ((std::size_t)(end - bounds.back()) <= step)
+            break;
+        bounds.push_back(NextLine(bounds.back() + step, end));
+    }
+    bounds.push_back(end);
+    // En : Neighbouring cuts may land on the same line.
+    // Tr : Komşu kesimler aynı satıra denk gelebilir.
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    return bounds;
+}
+
+// En : Number of pieces for a text of the given size, about 1 MB each and a few per worker at most.
+// Tr : Verilen boyuttaki bir metin için parça sayısı, her biri yaklaşık 1 MB ve işçi başına en fazla birkaç tane.
+int PieceCount(std::size_t size)
+{
+    return (int)std::max<std::size_t>(1, std::min<std::size_t>(size >> 20, WorkerCount() * 4));
+}
+
+// En : Result of a piece of an OBJ file. Negative indices are relative to the vertices before them, so they are resolved once the vertex counts of the earlier pieces are known.
+// Tr : Bir OBJ dosyası parçasının sonucu. Negatif indisler kendilerinden önceki köşelere görelidir, bu yüzden önceki parçaların köşe sayıları bilindiğinde çözülürler.
+struct OBJPiece
+{
+    std::vector<glm::vec3> positions;
+    std::vector<int> indices;
+    std::vector<std::size_t> relative;
+    bool valid = true;
+};
+
+void ParseOBJPiece(const char *p, const char *end, OBJPiece &piece)
+{
+    std::vector<std::pair<long long, bool>> corners;
+    while (p < end)
+    {
+        const char *lineEnd = NextLine(p, end);
+        p = SkipSpaces(p, lineEnd);
+        if (lineEnd - p > 2 && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+        {
+            // En : Only the position is read, the optional w and vertex colors are ignored.
+            // Tr : Yalnızca pozisyon okunur, isteğe bağlı w ve köşe renkleri yok sayılır.
+            p += 2;
+            glm::vec3 v;
+            if (!ParseNumber(p, lineEnd, v.x) || !ParseNumber(p, lineEnd, v.y) || !ParseNumber(p, lineEnd, v.z))
+                piece.valid = false;
+            piece.positions.push_back(v);
+        }
+        else if (lineEnd - p > 2 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+        {
+            // En : Only the vertex of every corner is read, "v/vt/vn" is cut at the first slash.
+            // Tr : Her köşenin yalnızca köşe indisi okunur, "v/vt/vn" ilk eğik çizgiden kesilir.
+            p += 2;
+            corners.clear();
+            while (true)
+            {
+                p = SkipSpaces(p, lineEnd);
+                if (p >= lineEnd || *p == '\n' || *p == '#')
+                    break;
+                long long value;
+                if (!ParseNumber(p, lineEnd, value) || value == 0)
+                {
+                    piece.valid = false;
+                    break;
+                }
+                if (value > 0)
+                    corners.push_back({value - 1, false});
+                else
+                    corners.push_back({(long long)piece.positions.size() + value, true});
+                while (p < lineEnd && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n')
+                    p++;
+            }
+            for (std::size_t i = 1; i + 1 < corners.size(); i++)
+                for (std::size_t corner : {(std::size_t)0, i, i + 1})
+                {
+                    if (corners[corner].second)
+                        piece.relative.push_back(piece.indices.size());
+                    piece.indices.push_back((int)corners[corner].first);
+                }
+        }
+        p = lineEnd;
+    }
+}
+
+bool ParseOBJ(const char *data, std::size_t size, ImportedMesh &mesh)
+{
+    std::vector<const char *> bounds = SplitLines(data, data + size, PieceCount(size));
+    int count = bounds.size() - 1;
+    std::vector<OBJPiece> pieces(count);
+    ParallelFor(0, count, 1, [&](int first, int last)
+                {
+                    for (int i = first; i < last; i++)
+                        ParseOBJPiece(bounds[i], bounds[i + 1], pieces[i]);
+                });
+
+    // En : Prefix sums of the piece sizes give the place of every piece in the mesh.
+    // Tr : Parça boyutlarının önek toplamları her parçanın meshteki yerini verir.
+    std::vector<std::size_t> vertexBase(count + 1, 0), indexBase(count + 1, 0);
+    for (int i = 0; i < count; i++)
+    {
+        if (!pieces[i].valid)
+            return false;
+        vertexBase[i + 1] = vertexBase[i] + pieces[i].positions.size();
+        indexBase[i + 1] = indexBase[i] + pieces[i].indices.size();
+    }
+    mesh.positions.resize(vertexBase[count]);
+    mesh.indices.resize(indexBase[count]);
+    std::vector<char> valid(count, 1);
+    ParallelFor(0, count, 1, [&](int first, int last)
+                {
+                    for (int i = first; i < last; i++)
+                    {
+                        OBJPiece &piece = pieces[i];
+                        std::copy(piece.positions.begin(), piece.positions.end(), mesh.positions.begin() + vertexBase[i]);
+                        int *indices = mesh.indices.data() + indexBase[i];
+                        std::copy(piece.indices.begin(), piece.indices.end(), indices);
+                        for (std::size_t slot : piece.relative)
+                            indices[slot] += (int)vertexBase[i];
+                        for (std::size_t j = 0; j < piece.indices.size(); j++)
+                            if (indices[j] < 0 || indices[j] >= (long long)vertexBase[count])
+                                valid[i] = 0;
+                        piece = OBJPiece();
+                    }
+                });
+    return std::find(valid.begin(), valid.end(), 0) == valid.end();
+}
+
+// En : Scalar types of PLY properties, in the order of their sizes table.
+// Tr : PLY özelliklerinin skaler tipleri, boyut tablosundaki sıralarıyla.
+enum class PLYType
+{
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64,
+    Invalid
+};
+const int PLYTypeSizes[] = {1, 1, 2, 2, 4, 4, 4, 8};
+
+struct PLYProperty
+{
+    std::string name;
+    PLYType type, countType;
+    bool list;
+};
+
+struct PLYElement
+{
+    std::string name;
+    std::size_t count;
+    std::vector<PLYProperty> properties;
+};
+
+PLYType ParsePLYType(const std::string &name)
+{
+    const std::pair<const char *, PLYType> names[] = {
+        {"char", PLYType::Int8}, {"int8", PLYType::Int8}, {"uchar", PLYType::UInt8}, {"uint8", PLYType::UInt8}, {"short", PLYType::Int16}, {"int16", PLYType::Int16}, {"ushort", PLYType::UInt16}, {"uint16", PLYType::UInt16}, {"int", PLYType::Int32}, {"int32", PLYType::Int32}, {"uint", PLYType::UInt32}, {"uint32", PLYType::UInt32}, {"float", PLYType::Float32}, {"float32", PLYType::Float32}, {"double", PLYType::Float64}, {"float64", PLYType::Float64}};
+    for (const std::pair<const char *, PLYType> &pair : names)
+        if (name == pair.first)
+            return pair.second;
+    return PLYType::Invalid;
+}
+
+// En : Read a binary scalar of any type as double, swapping the bytes if the file has the other endianness.
+// Tr : Herhangi bir tipteki ikili skaleri double olarak oku, dosya diğer bayt sıralamasına sahipse baytları değiştir.
+double ReadPLYScalar(const char *p, PLYType type, bool swap)
+{
+    unsigned char bytes[8];
+    int size = PLYTypeSizes[(int)type];
+    std::memcpy(bytes, p, size);
+    if (swap)
+        std::reverse(bytes, bytes + size);
+    switch (type)
+    {
+    case PLYType::Int8:
+        return (double)(int8_t)bytes[0];
+    case PLYType::UInt8:
+        return (double)bytes[0];
+    case PLYType::Int16:
+    {
+        int16_t value;
+        std::memcpy(&value, bytes, 2);
+        return value;
+    }
+    case PLYType::UInt16:
+    {
+        uint16_t value;
+        std::memcpy(&value, bytes, 2);
+        return value;
+    }
+    case PLYType::Int32:
+    {
+        int32_t value;
+        std::memcpy(&value, bytes, 4);
+        return value;
+    }
+    case PLYType::UInt32:
+    {
+        uint32_t value;
+        std::memcpy(&value, bytes, 4);
+        return value;
+    }
+    case PLYType::Float32:
+    {
+        float value;
+        std::memcpy(&value, bytes, 4);
+        return value;
+    }
+    case PLYType::Float64:
+    {
+        double value;
+        std::memcpy(&value, bytes, 8);
+        return value;
+    }
+    default:
+        return 0.0;
+    }
+}
+
+// En : Index of the property with one of the given names, -1 if there is none.
+// Tr : Verilen isimlerden birine sahip özelliğin indisi, yoksa -1.
+int FindPLYProperty(const PLYElement &element, std::initializer_list<const char *> names)
+{
+    for (int i = 0; i < (int)element.properties.size(); i++)
+        for (const char *name : names)
+            if (element.properties[i].name == name)
+                return i;
+    return -1;
+}
+
+// En : Append the fan triangulation of a face to indices.
+// Tr : Bir yüzün yelpaze üçgenlemesini indislere ekle.
+void AddPLYFace(const std::vector<int> &corners, std::vector<int> &indices)
+{
+    for (std::size_t i = 1; i + 1 < corners.size(); i++)
+    {
+        indices.push_back(corners[0]);
+        indices.push_back(corners[i]);
+        indices.push_back(corners[i + 1]);
+    }
+}
+
+// En : Walk one binary record. The face corners are collected if corners is not null. Returns nullptr if the record runs past the end.
+// Tr : Bir ikili kayıt boyunca ilerle. corners boş değilse yüz köşeleri toplanır. Kayıt sonu aşarsa nullptr döndürür.
+const char *ReadPLYBinaryRecord(const char *p, const char *end, const PLYElement &element, bool swap, int cornerProperty, std::vector<int> *corners)
+{
+    for (int i = 0; i < (int)element.properties.size(); i++)
+    {
+        const PLYProperty &property = element.properties[i];
+        if (!property.list)
+        {
+            p += PLYTypeSizes[(int)property.type];
+            if (p > end)
+                return nullptr;
+            continue;
+        }
+        if (p + PLYTypeSizes[(int)property.countType] > end)
+            return nullptr;
+        std::size_t count = (std::size_t)ReadPLYScalar(p, property.countType, swap);
+        p += PLYTypeSizes[(int)property.countType];
+        int itemSize = PLYTypeSizes[(int)property.type];
+        if ((std::size_t)(end - p) < count * itemSize)
+            return nullptr;
+        if (corners && i == cornerProperty)
+        {
+            corners->resize(count);
+            for (std::size_t j = 0; j < count; j++)
+                (*corners)[j] = (int)ReadPLYScalar(p + j * itemSize, property.type, swap);
+        }
+        p += count * itemSize;
+    }
+    return p;
+}
+
+// En : Read the faces of a binary file. Meshes made of a single polygon size have fixed size records, which are read in parallel. Mixed polygons are walked in order.
+// Tr : İkili bir dosyanın yüzlerini oku. Tek bir çokgen boyutundan oluşan meshlerin kayıtları sabit boyutludur ve paralel okunur. Karışık çokgenler sırayla gezilir.
+const char *ReadPLYBinaryFaces(const char *p, const char *end, const PLYElement &element, bool swap, std::vector<int> &indices)
+{
+    int cornerProperty = FindPLYProperty(element, {"vertex_indices", "vertex_index"});
+    if (cornerProperty < 0 || !element.properties[cornerProperty].list)
+        return nullptr;
+    if (element.count && element.properties.size() == 1)
+    {
+        const PLYProperty &property = element.properties[0];
+        int countSize = PLYTypeSizes[(int)property.countType], itemSize = PLYTypeSizes[(int)property.type];
+        std::size_t corners = p + countSize <= end ? (std::size_t)ReadPLYScalar(p, property.countType, swap) : 0;
+        std::size_t stride = countSize + corners * itemSize;
+        if (corners >= 3 && (std::size_t)(end - p) / stride >= element.count)
+        {
+            std::size_t triangles = corners - 2;
+            indices.resize(element.count * triangles * 3);
+            int count = (int)std::min<std::size_t>(element.count, INT32_MAX);
+            if (count == (long long)element.count)
+            {
+                std::vector<char> valid(count, 1);
+                ParallelFor(0, count, 16384, [&](int first, int last)
+                            {
+                                for (int i = first; i < last; i++)
+                                {
+                                    const char *record = p + i * stride;
+                                    if ((std::size_t)ReadPLYScalar(record, property.countType, swap) != corners)
+                                    {
+                                        valid[first] = 0;
+                                        return;
+                                    }
+                                    int *output = indices.data() + (std::size_t)i * triangles * 3;
+                                    int origin = (int)ReadPLYScalar(record + countSize, property.type, swap);
+                                    for (std::size_t j = 1; j + 1 < corners; j++)
+                                    {
+                                        *output++ = origin;
+                                        *output++ = (int)ReadPLYScalar(record + countSize + j * itemSize, property.type, swap);
+                                        *output++ = (int)ReadPLYScalar(record + countSize + (j + 1) * itemSize, property.type, swap);
+                                    }
+                                }
+                            });
+                if (std::find(valid.begin(), valid.end(), 0) == valid.end())
+                    return p + element.count * stride;
+            }
+            indices.clear();
+        }
+    }
+    std::vector<int> corners;
+    for (std::size_t i = 0; i < element.count && p; i++)
+    {
+        p = ReadPLYBinaryRecord(p, end, element, swap, cornerProperty, &corners);
+        AddPLYFace(corners, indices);
+    }
+    return p;
+}
+
+// En : Read the vertices of a binary file. The records have a fixed size unless the element has list properties, so every vertex can be read independently.
+// Tr : İkili bir dosyanın köşelerini oku. Eleman liste özelliklerine sahip değilse kayıtlar sabit boyutludur, böylece her köşe bağımsız okunabilir.
+const char *ReadPLYBinaryVertices(const char *p, const char *end, const PLYElement &element, bool swap, std::vector<glm::vec3> &positions)
+{
+    int axes[3] = {FindPLYProperty(element, {"x"}), FindPLYProperty(element, {"y"}), FindPLYProperty(element, {"z"})};
+    if (axes[0] < 0 || axes[1] < 0 || axes[2] < 0)
+        return nullptr;
+    std::size_t stride = 0, offsets[3];
+    for (int i = 0; i < (int)element.properties.size(); i++)
+    {
+        const PLYProperty &property = element.properties[i];
+        if (property.list)
+        {
+            std::cout << "Error: list properties of PLY vertices are not supported." << std::endl;
+            return nullptr;
+        }
+        for (int axis = 0; axis < 3; axis++)
+            if (axes[axis] == i)
+                offsets[axis] = stride;
+        stride += PLYTypeSizes[(int)property.type];
+    }
+    if ((std::size_t)(end - p) / stride < element.count || element.count > INT32_MAX)
+        return nullptr;
+    positions.resize(element.count);
+    PLYType types[3] = {element.properties[axes[0]].type, element.properties[axes[1]].type, element.properties[axes[2]].type};
+    ParallelFor(0, (int)element.count, 16384, [&](int first, int last)
+                {
+                    for (int i = first; i < last; i++)
+                    {
+                        const char *record = p + i * stride;
+                        for (int axis = 0; axis < 3; axis++)
+                            positions[i][axis] = (float)ReadPLYScalar(record + offsets[axis], types[axis], swap);
+                    }
+                });
+    return p + element.count * stride;
+}
+
+// En : Parse the ASCII lines of an element. Every record is one line, the section is split into pieces that are parsed in parallel and merged in order.
+// Tr : Bir elemanın ASCII satırlarını ayrıştır. Her kayıt bir satırdır, bölüm paralel ayrıştırılan ve sırayla birleştirilen parçalara bölünür.
+bool ParsePLYText(const char *begin, const char *end, const PLYElement &element, std::vector<glm::vec3> *positions, std::vector<int> *indices)
+{
+    int axes[3] = {FindPLYProperty(element, {"x"}), FindPLYProperty(element, {"y"}), FindPLYProperty(element, {"z"})};
+    int cornerProperty = FindPLYProperty(element, {"vertex_indices", "vertex_index"});
+    if ((positions && (axes[0] < 0 || axes[1] < 0 || axes[2] < 0)) || (indices && cornerProperty < 0))
+        return false;
+    std::vector<const char *> bounds = SplitLines(begin, end, PieceCount(end - begin));
+    int count = bounds.size() - 1;
+    std::vector<std::vector<glm::vec3>> piecePositions(count);
+    std::vector<std::vector<int>> pieceIndices(count);
+    std::vector<char> valid(count, 1);
+    ParallelFor(0, count, 1, [&](int first, int last)
+                {
+                    std::vector<int> corners;
+                    for (int i = first; i < last; i++)
+                        for (const char *p = bounds[i]; p < bounds[i + 1] && valid[i];)
+                        {
+                            const char *lineEnd = NextLine(p, bounds[i + 1]);
+                            glm::vec3 v(0.0f);
+                            for (int j = 0; j < (int)element.properties.size() && valid[i]; j++)
+                            {
+                                const PLYProperty &property = element.properties[j];
+                                double value;
+                                if (!ParseNumber(p, lineEnd, value))
+                                {
+                                    valid[i] = 0;
+                                    break;
+                                }
+                                if (!property.list)
+                                {
+                                    for (int axis = 0; axis < 3; axis++)
+                                        if (axes[axis] == j)
+                                            v[axis] = (float)value;
+                                    continue;
+                                }
+                                if (value < 0 || value > lineEnd - p)
+                                {
+                                    valid[i] = 0;
+                                    break;
+                                }
+                                corners.resize((std::size_t)value);
+                                for (int &corner : corners)
+                                    if (!ParseNumber(p, lineEnd, corner))
+                                        valid[i] = 0;
+                                if (indices && j == cornerProperty)
+                                    AddPLYFace(corners, pieceIndices[i]);
+                            }
+                            if (positions)
+                                piecePositions[i].push_back(v);
+                            p = lineEnd;
+                        }
+                });
+    if (std::find(valid.begin(), valid.end(), 0) != valid.end())
+        return false;
+    for (int i = 0; i < count; i++)
+    {
+        if (positions)
+            positions->insert(positions->end(), piecePositions[i].begin(), piecePositions[i].end());
+        if (indices)
+            indices->insert(indices->end(), pieceIndices[i].begin(), pieceIndices[i].end());
+    }
+    return !positions || positions->size() == element.count;
+}
+
+bool ParsePLY(const char *data, std::size_t size, ImportedMesh &mesh)
+{
+    // En : Step 1 : Read the header line by line.
+    // Tr : Adım 1 : Başlığı satır satır oku.
+    const char *end = data + size, *p = data;
+    enum
+    {
+        Ascii,
+        Little,
+        Big
+    } format = Ascii;
+    std::vector<PLYElement> elements;
+    bool header = false, magic = false;
+    while (p < end && !header)
+    {
+        const char *lineEnd = NextLine(p, end);
+        std::string line(p, lineEnd);
+        p = lineEnd;
+        std::stringstream ss(line);
+        std::string keyword;
+        ss >> keyword;
+        if (!magic)
+        {
+            if (keyword != "ply")
+                return false;
+            magic = true;
+        }
+        else if (keyword == "format")
+        {
+            std::string name;
+            ss >> name;
+            if (name == "ascii")
+                format = Ascii;
+            else if (name == "binary_little_endian")
+                format = Little;
+            else if (name == "binary_big_endian")
+                format = Big;
+            else
+                return false;
+        }
+        else if (keyword == "element")
+        {
+            PLYElement element;
+            if (!(ss >> element.name >> element.count))
+                return false;
+            elements.push_back(element);
+        }
+        else if (keyword == "property")
+        {
+            std::string type, countType, name;
+            if (!(ss >> type) || elements.empty())
+                return false;
+            PLYProperty property;
+            property.list = type == "list";
+            if (property.list)
+            {
+                ss >> countType >> type;
+                property.countType = ParsePLYType(countType);
+            }
+            else
+                property.countType = PLYType::UInt8;
+            property.type = ParsePLYType(type);
+            if (!(ss >> property.name) || property.type == PLYType::Invalid || property.countType == PLYType::Invalid)
+                return false;
+            elements.back().properties.push_back(property);
+        }
+        else if (keyword == "end_header")
+            header = true;
+    }
+    if (!header)
+        return false;
+
+    // En : Step 2 : Read the elements in the order of the header, skipping the ones that are not needed.
+    // Tr : Adım 2 : Elemanları başlık sırasıyla oku, gerekmeyenleri atla.
+    const uint16_t probe = 1;
+    bool swap = format != Ascii && (format == Little) != (*(const char *)&probe == 1);
+    for (const PLYElement &element : elements)
+    {
+        bool vertices = element.name == "vertex", faces = element.name == "face";
+        if (format == Ascii)
+        {
+            // En : The end of the section is found by counting lines, which is a memchr per record.
+            // Tr : Bölümün sonu satırlar sayılarak bulunur, bu kayıt başına bir memchr'dır.
+            const char *sectionEnd = p;
+            for (std::size_t i = 0; i < element.count && sectionEnd < end; i++)
+                sectionEnd = NextLine(sectionEnd, end);
+            if ((vertices || faces) && !ParsePLYText(p, sectionEnd, element, vertices ? &mesh.positions : nullptr, faces ? &mesh.indices : nullptr))
+                return false;
+            p = sectionEnd;
+        }
+        else if (vertices)
+            p = ReadPLYBinaryVertices(p, end, element, swap, mesh.positions);
+        else if (faces)
+            p = ReadPLYBinaryFaces(p, end, element, swap, mesh.indices);
+        else
+            for (std::size_t i = 0; i < element.count && p; i++)
+                p = ReadPLYBinaryRecord(p, end, element, swap, -1, nullptr);
+        if (!p)
+            return false;
+    }
+
+    // En : Step 3 : Validate the indices.
+    // Tr : Adım 3 : İndisleri doğrula.
+    int vertexCount = mesh.positions.size();
+    return std::all_of(mesh.indices.begin(), mesh.indices.end(), [&](int index)
+                       { return index >= 0 && index < vertexCount; });
+}
+
+std::shared_ptr<const ImportedMesh> ImportMesh(const std::string &path)
+{
+    // En : The lock is held while parsing, so that two elements importing the same file do not parse it twice. Failures are cached too, the error is reported once.
+    // Tr : Kilit ayrıştırma sırasında tutulur, böylece aynı dosyayı içe aktaran iki eleman onu iki kez ayrıştırmaz. Başarısızlıklar da önbelleğe alınır, hata bir kez bildirilir.
+    std::lock_guard<std::mutex> lock(GlobalImportsMutex);
+    std::map<std::string, std::shared_ptr<const ImportedMesh>>::iterator found = GlobalImports.find(path);
+    if (found != GlobalImports.end())
+        return found->second;
+
+    std::string extension = path.find_last_of('.') == std::string::npos ? "" : path.substr(path.find_last_of('.') + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), tolower);
+    std::shared_ptr<ImportedMesh> mesh = std::make_shared<ImportedMesh>();
+    MappedFile file(path);
+    if (extension != "obj" && extension != "ply")
+    {
+        std::cout << "Error: unsupported import format : " << path << ". Only OBJ and PLY files are accepted." << std::endl;
+        mesh = nullptr;
+    }
+    else if (!file.IsOpen())
+    {
+        std::cout << "Error: cannot open import file : " << path << std::endl;
+        mesh = nullptr;
+    }
+    else if (!(extension == "obj" ? ParseOBJ(file.GetData(), file.GetSize(), *mesh) : ParsePLY(file.GetData(), file.GetSize(), *mesh)))
+    {
+        std::cout << "Error: invalid " << extension << " file : " << path << std::endl;
+        mesh = nullptr;
+    }
+    GlobalImports[path] = mesh;
+    return mesh;
+}
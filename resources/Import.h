@@ -0,0 +1,58 @@
+// En : This file contains the class and function prototypes for importing external meshes. OBJ and PLY (ASCII and binary) files are memory mapped and parsed on every core.
+// Tr : Bu dosya, harici meshleri içe aktarmak için sınıf ve fonksiyon prototiplerini içerir. OBJ ve PLY (ASCII ve ikili) dosyaları belleğe eşlenir ve her çekirdekte ayrıştırılır.
+#include <glm/glm.hpp>
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#ifndef IMPORT_H
+#define IMPORT_H
+
+// En : Read only view of a whole file. The view stays valid until the object is destroyed.
+// Tr : Bütün bir dosyanın salt okunur görünümü. Görünüm nesne yok edilene kadar geçerli kalır.
+class MappedFile
+{
+private:
+    const char *data = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    void *file = nullptr, *mapping = nullptr;
+#else
+    int descriptor = -1;
+#endif
+
+public:
+    MappedFile(const std::string &path);
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    bool IsOpen() const;
+    const char *GetData() const;
+    std::size_t GetSize() const;
+};
+
+// En : Triangulated mesh read from a file. Faces with more than three corners are split into fans.
+// Tr : Bir dosyadan okunan üçgenlenmiş mesh. Üçten fazla köşesi olan yüzler yelpazelere bölünür.
+struct ImportedMesh
+{
+    std::vector<glm::vec3> positions;
+    std::vector<int> indices;
+};
+
+// En : Parsed meshes by path. Every file is parsed once, later imports share the result.
+// Tr : Yola göre ayrıştırılmış meshler. Her dosya bir kez ayrıştırılır, sonraki içe aktarmalar sonucu paylaşır.
+std::map<std::string, std::shared_ptr<const ImportedMesh>> GlobalImports;
+std::mutex GlobalImportsMutex;
+
+// En : Get the mesh of a file, parsing it on first use. The format is chosen by the extension. Returns nullptr if the file cannot be read.
+// Tr : Bir dosyanın meshini al, ilk kullanımda ayrıştırarak. Biçim uzantıya göre seçilir. Dosya okunamazsa nullptr döndürür.
+std::shared_ptr<const ImportedMesh> ImportMesh(const std::string &path);
+
+// En : Parsers of the supported formats. They return false on malformed input.
+// Tr : Desteklenen biçimlerin ayrıştırıcıları. Hatalı girdide false döndürürler.
+bool ParseOBJ(const char *data, std::size_t size, ImportedMesh &mesh);
+bool ParsePLY(const char *data, std::size_t size, ImportedMesh &mesh);
+
+#endif
@@ -0,0 +1,142 @@
+// En : Definitions of Jobs.h file.
+// Tr : Jobs.h dosyasının tanımlamaları.
+#include "Jobs.h"
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+unsigned int WorkerCount()
+{
+    static const unsigned int count = std::max(std::thread::hardware_concurrency(), 1u);
+    return count;
+}
+
+// En : Threads of the pool, and threads running a job, call nested jobs inline.
+// Tr : Havuzun iş parçacıkları ve bir iş çalıştıran iş parçacıkları iç içe işleri satır içinde çağırır.
+thread_local bool InsideJob = false;
+
+// En : The worker threads are started once and sleep between jobs, so a job per frame costs no thread start.
+// Tr : İşçi iş parçacıkları bir kez başlatılır ve işler arasında uyur, böylece her karedeki bir iş iş parçacığı başlatmaya mal olmaz.
+class JobPool
+{
+private:
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake, finished;
+    const std::function<void(int, int)> *body = nullptr;
+    int begin = 0, end = 0, step = 1;
+    std::atomic<int> next{0};
+    int active = 0;
+    unsigned int generation = 0;
+    bool stop = false;
+
+    // En : Take chunks until none is left.
+    // Tr : Hiç kalmayana kadar parça al.
+    void Run()
+    {
+        for (int first = begin + step * next++; first < end; first = begin + step * next++)
+            (*body)(first, std::min(first + step, end));
+    }
+    void Work()
+    {
+        InsideJob = true;
+        unsigned int seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            wake.wait(lock, [&]
+                      { return stop || generation != seen; });
+            if (stop)
+                return;
+            seen = generation;
+            active++;
+            lock.unlock();
+            Run();
+            lock.lock();
+            if (--active == 0)
+                finished.notify_all();
+        }
+    }
+
+public:
+    // En : Serializes the callers. A caller that finds the pool busy runs its range itself.
+    // Tr : Çağıranları sıraya koyar. Havuzu meşgul bulan bir çağıran aralığını kendisi çalıştırır.
+    std::mutex submit;
+
+    JobPool()
+    {
+        for (unsigned int i = 1; i < WorkerCount(); i++)
+            threads.emplace_back(&JobPool::Work, this);
+    }
+    ~JobPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for (std::thread &thread : threads)
+            thread.join();
+    }
+    void Execute(int begin, int end, int step, const std::function<void(int, int)> &body)
+    {
+        {
+            // En : Workers that woke up late for the previous job must leave it before its state is replaced.
+            // Tr : Önceki iş için geç uyanan işçiler, durumu değiştirilmeden önce ondan çıkmalıdır.
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&]
+                          { return active == 0; });
+            this->body = &body;
+            this->begin = begin;
+            this->end = end;
+            this->step = step;
+            next = 0;
+            generation++;
+        }
+        wake.notify_all();
+
+        // En : The calling thread takes chunks too, then waits for the chunks the workers took.
+        // Tr : Çağıran iş parçacığı da parça alır, sonra işçilerin aldığı parçaları bekler.
+        InsideJob = true;
+        Run();
+        InsideJob = false;
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&]
+                      { return active == 0; });
+    }
+};
+
+JobPool &GetJobPool()
+{
+    static JobPool pool;
+    return pool;
+}
+
+void ParallelFor(int begin, int end, int grain, const std::function<void(int, int)> &body)
+{
+    int length = end - begin;
+    if (length <= 0)
+        return;
+    grain = std::max(grain, 1);
+
+    // En : Small ranges are not worth waking the workers.
+    // Tr : Küçük aralıklar için işçileri uyandırmaya değmez.
+    int chunks = std::min<int>(WorkerCount(), (length + grain - 1) / grain);
+    if (chunks <= 1 || InsideJob)
+    {
+        body(begin, end);
+        return;
+    }
+
+    JobPool &pool = GetJobPool();
+    std::unique_lock<std::mutex> lock(pool.submit, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        body(begin, end);
+        return;
+    }
+    pool.Execute(begin, end, (length + chunks - 1) / chunks, body);
+}
@@ -0,0 +1,15 @@
+// En : This file contains the function prototypes for splitting work across the CPU cores.
+// Tr : Bu dosya, işi işlemci çekirdeklerine bölen fonksiyonların prototiplerini içerir.
+#include <functional>
+#ifndef JOBS_H
+#define JOBS_H
+
+// En : Number of threads that parallel work is split into.
+// Tr : Paralel işin bölündüğü iş parçacığı sayısı.
+unsigned int WorkerCount();
+
+// En : Calls body(first, last) for chunks of [begin, end) on every core, using a pool of persistent worker threads. Ranges smaller than grain, nested calls and calls made while another thread uses the pool run on the calling thread.
+// Tr : Kalıcı işçi iş parçacıklarından oluşan bir havuz kullanarak [begin, end) aralığının parçaları için her çekirdekte body(first, last) çağırır. grain değerinden küçük aralıklar, iç içe çağrılar ve başka bir iş parçacığı havuzu kullanırken yapılan çağrılar çağıran iş parçacığında çalışır.
+void ParallelFor(int begin, int end, int grain, const std::function<void(int, int)> &body);
+
+#endif
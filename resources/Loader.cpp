@@ -0,0 +1,325 @@
+// En : Definitions of Loader.h file.
+// Tr : Loader.h dosyasının tanımlamaları.
+#include "Loader.h"
+#include "Jobs.h"
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <iostream>
+
+SceneLoader::SceneLoader(const char *path, int chunkSize)
+{
+    std::string file = path;
+    worker = std::thread([this, file, chunkSize]()
+                         {
+                             document.LoadFile(file.c_str());
+                             tinyxml2::XMLElement *root = document.RootElement();
+                             if (!root)
+                             {
+                                 std::cout << "Error: scene could not be loaded : " << file << std::endl;
+                                 finished = true;
+                                 return;
+                             }
+                             std::ifstream source(file, std::ios::binary | std::ios::ate);
+                             documentMemory.Set(source ? (long long)source.tellg() : 0);
+                             if (GlobalNormalMode != NormalMode::None)
+                                 GlobalNormalMode = ParseNormalMode(root->Attribute("normals"), GlobalNormalMode);
+                             totalTags = CountTags(root);
+                             AnalyzeTag(root, chunkSize, [this](MeshChunk &chunk)
+                                        {
+                                            if (!chunk.elementCount)
+                                                return;
+                                            loadedTags += chunk.elementCount;
+                                            std::lock_guard<std::mutex> lock(mutex);
+                                            chunkBytes += chunk.data.GetBytes();
+                                            chunkMemory.Set(chunkBytes);
+                                            chunks.push_back(std::move(chunk)); });
+                             finished = true; });
+}
+
+SceneLoader::~SceneLoader()
+{
+    if (worker.joinable())
+        worker.join();
+}
+
+bool SceneLoader::Poll(MeshChunk &chunk)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (chunks.empty())
+        return false;
+    chunkBytes -= chunks.front().data.GetBytes();
+    chunkMemory.Set(chunkBytes);
+    chunk = std::move(chunks.front());
+    chunks.pop_front();
+    return true;
+}
+
+bool SceneLoader::IsFinished()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return finished && chunks.empty();
+}
+
+float SceneLoader::GetProgress() const
+{
+    if (finished)
+        return 1.0f;
+    return totalTags ? (float)loadedTags / totalTags : 0.0f;
+}
+
+MeshStream::MeshStream(unsigned int shadow, int stagingSize) : stagingSize(stagingSize), persistent(GLEW_ARB_buffer_storage), shadow(shadow)
+{
+    glGenVertexArrays(1, &vertexArray);
+    // En : Scenes without gradients have no color stream, the disabled attribute then reads white and the material alone gives the color.
+    // Tr : Gradyanı olmayan sahnelerin renk akışı yoktur, devre dışı nitelik beyaz okunur ve rengi yalnızca malzeme verir.
+    glVertexAttrib3f(attributeLocations[(int)VertexAttribute::Color], 1.0f, 1.0f, 1.0f);
+    if (persistent)
+        return;
+    glGenBuffers(1, &stagingBuffer);
+    GlobalState.BindBuffer(GL_COPY_READ_BUFFER, stagingBuffer);
+    GlobalState.BufferData(GL_COPY_READ_BUFFER, stagingSize, nullptr, GL_STREAM_DRAW);
+}
+
+MeshStream::~MeshStream()
+{
+    for (StagingRegion &region : regions)
+        glDeleteSync(region.fence);
+    if (stagingBuffer)
+        GlobalState.DeleteBuffer(stagingBuffer);
+    for (AttributeStream &stream : streams)
+        GlobalState.DeleteBuffer(stream.buffer);
+    GlobalState.DeleteBuffer(elementBuffer);
+    GlobalState.DeleteVertexArray(vertexArray);
+}
+
+void MeshStream::Push(MeshChunk &chunk)
+{
+    if (!chunk.data.Has(VertexAttribute::Position))
+    {
+        std::cout << "Data is not complete\n";
+        return;
+    }
+    // En : The attributes of the first chunk decide the streams.
+    // Tr : İlk parçanın nitelikleri akışları belirler.
+    if (streams.empty())
+        for (int attribute = 0; attribute < (int)VertexAttribute::Count; attribute++)
+            if (chunk.data.Has((VertexAttribute)attribute))
+                streams.push_back({(VertexAttribute)attribute, 0, 0, 0, nullptr});
+    for (AttributeStream &stream : streams)
+        if (!chunk.data.Has(stream.attribute))
+        {
+            std::cout << "Data is not complete\n";
+            return;
+        }
+
+    PendingChunk pushed;
+    pushed.vertexBegin = vertexCount;
+    pushed.indexBegin = indexCount;
+    vertexCount = pushed.vertexEnd = vertexCount + chunk.data.GetSize();
+    indexCount = pushed.indexEnd = indexCount + chunk.data.indices.size();
+    if (shadow)
+        store.Append(chunk.data, shadow);
+    pushed.data = std::move(chunk.data);
+    pendingBytes += pushed.data.GetBytes();
+    pending.push_back(std::move(pushed));
+    memory.Set(store.GetBytes() + pendingBytes);
+}
+
+bool MeshStream::Stage(const void *data, int bytes, int &offset)
+{
+    // En : Retire the regions whose copies are finished, without waiting for the others.
+    // Tr : Kopyalaması biten bölgeleri, diğerlerini beklemeden serbest bırak.
+    while (!regions.empty())
+    {
+        GLenum status = glClientWaitSync(regions.front().fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            break;
+        glDeleteSync(regions.front().fence);
+        regions.pop_front();
+    }
+
+    int begin = stagingHead + bytes > stagingSize ? 0 : stagingHead;
+    for (StagingRegion &region : regions)
+        if (begin < region.end && region.begin < begin + bytes)
+            return false;
+
+    GlobalState.BindBuffer(GL_COPY_READ_BUFFER, stagingBuffer);
+    void *target = glMapBufferRange(GL_COPY_READ_BUFFER, begin, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!target)
+        return false;
+    std::memcpy(target, data, bytes);
+    glUnmapBuffer(GL_COPY_READ_BUFFER);
+    GlobalState.CountUpload(bytes);
+    stagingHead = begin + bytes;
+    offset = begin;
+    return true;
+}
+
+bool MeshStream::Upload(GLuint &buffer, GLsizeiptr &capacity, char *&mapping, GLintptr destination, const void *data, int bytes)
+{
+    int offset;
+    if (!persistent && !Stage(data, bytes, offset))
+        return false;
+
+    // En : Grow the destination by doubling. The old content is copied on the GPU.
+    // Tr : Hedefi iki katına çıkararak büyüt. Eski içerik GPU üzerinde kopyalanır.
+    if (destination + bytes > capacity)
+    {
+        GLsizeiptr newCapacity = std::max<GLsizeiptr>(destination + bytes, 2 * capacity);
+        GLuint newBuffer;
+        glGenBuffers(1, &newBuffer);
+        GlobalState.BindBuffer(GL_COPY_WRITE_BUFFER, newBuffer);
+        if (persistent)
+        {
+            // En : Dynamic storage keeps BufferSubData available for the rewrites of transformed ranges.
+            // Tr : Dinamik depolama, dönüştürülmüş aralıkların yeniden yazılması için BufferSubData'yı kullanılabilir tutar.
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            GlobalState.BufferStorage(GL_COPY_WRITE_BUFFER, newCapacity, nullptr, flags | GL_DYNAMIC_STORAGE_BIT);
+            mapping = (char *)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, newCapacity, flags);
+        }
+        else
+            GlobalState.BufferData(GL_COPY_WRITE_BUFFER, newCapacity, nullptr, GL_DYNAMIC_DRAW);
+        if (buffer)
+        {
+            GlobalState.BindBuffer(GL_COPY_READ_BUFFER, buffer);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, destination);
+            GlobalState.DeleteBuffer(buffer);
+        }
+        buffer = newBuffer;
+        capacity = newCapacity;
+        SetLayout();
+    }
+
+    if (persistent)
+    {
+        // En : The mapping is coherent, so the writes are visible to every command issued after them. The ranges are not drawn before they are written.
+        // Tr : Eşleme tutarlıdır, böylece yazmalar onlardan sonra verilen her komuta görünür. Aralıklar yazılmadan önce çizilmez.
+        const int grain = 1 << 18;
+        ParallelFor(0, (bytes + grain - 1) / grain, 1, [&](int first, int last)
+                    { std::memcpy(mapping + destination + first * grain, (const char *)data + first * grain, std::min(last * grain, bytes) - first * grain); });
+        GlobalState.CountUpload(bytes);
+        return true;
+    }
+
+    GlobalState.BindBuffer(GL_COPY_READ_BUFFER, stagingBuffer);
+    GlobalState.BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, destination, bytes);
+    regions.push_back({glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), offset, offset + bytes});
+    return true;
+}
+
+void MeshStream::SetLayout()
+{
+    GlobalState.BindVertexArray(vertexArray);
+    if (elementBuffer)
+        GlobalState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer);
+    for (AttributeStream &stream : streams)
+    {
+        if (!stream.buffer)
+            continue;
+        GLuint location = attributeLocations[(int)stream.attribute];
+        GLuint size = attributeSizes[(int)stream.attribute];
+        GlobalState.BindBuffer(GL_ARRAY_BUFFER, stream.buffer);
+        if (stream.attribute == VertexAttribute::Object)
+            glVertexAttribIPointer(location, size, GL_INT, size * sizeof(int), (void *)0);
+        else
+            glVertexAttribPointer(location, size, GL_FLOAT, GL_FALSE, size * sizeof(float), (void *)0);
+        glEnableVertexAttribArray(location);
+    }
+}
+
+int MeshStream::Update(int byteBudget)
+{
+    // En : Pieces are kept below a quarter of the staging ring, so that several transfers can be in flight. Mapped buffers are written in one piece.
+    // Tr : Birkaç aktarım aynı anda sürebilsin diye parçalar ara tampon halkasının dörtte birinin altında tutulur. Eşlenmiş tamponlar tek parçada yazılır.
+    int uploaded = 0, piece = persistent ? byteBudget : stagingSize / 4;
+    while (!pending.empty() && uploaded < byteBudget)
+    {
+        PendingChunk &range = pending.front();
+        std::vector<AttributeStream>::iterator stream = std::find_if(streams.begin(), streams.end(), [&range](const AttributeStream &stream)
+                                                                     { return stream.uploaded < range.vertexEnd; });
+        if (stream != streams.end())
+        {
+            // En : Shadowed attributes are read from the CPU copy, the others from the chunk.
+            // Tr : Gölgelenen nitelikler CPU kopyasından, diğerleri parçadan okunur.
+            bool shadowed = store.Has(stream->attribute);
+            StreamView view = shadowed ? store.View(stream->attribute) : range.data.View(stream->attribute);
+            const char *data = view.data + (GLintptr)(stream->uploaded - (shadowed ? 0 : range.vertexBegin)) * view.stride;
+            int stride = view.stride;
+            int bytes = (int)std::min<GLsizeiptr>((GLsizeiptr)(range.vertexEnd - stream->uploaded) * stride, std::min(piece, byteBudget - uploaded));
+            bytes -= bytes % stride;
+            if (!bytes || !Upload(stream->buffer, stream->capacity, stream->mapping, (GLintptr)stream->uploaded * stride, data, bytes))
+                break;
+            stream->uploaded += bytes / stride;
+            uploaded += bytes;
+        }
+        else if (uploadedIndices < range.indexEnd)
+        {
+            int bytes = (int)std::min<GLsizeiptr>((GLsizeiptr)(range.indexEnd - uploadedIndices) * sizeof(int), std::min(piece, byteBudget - uploaded));
+            bytes -= bytes % (3 * sizeof(int));
+            const int *data = shadow ? store.indices.data() + uploadedIndices : range.data.indices.data() + uploadedIndices - range.indexBegin;
+            if (!bytes || !Upload(elementBuffer, indexCapacity, indexMapping, (GLintptr)uploadedIndices * sizeof(int), data, bytes))
+                break;
+            uploadedIndices += bytes / sizeof(int);
+            uploaded += bytes;
+            // En : Whole triangles whose vertices are on the GPU can be drawn right away.
+            // Tr : Köşeleri GPU'da olan tam üçgenler hemen çizilebilir.
+            drawableIndices = uploadedIndices;
+        }
+        else
+        {
+            pendingBytes -= range.data.GetBytes();
+            pending.pop_front();
+        }
+    }
+    memory.Set(store.GetBytes() + pendingBytes);
+    return uploaded;
+}
+
+void MeshStream::Rewrite(VertexAttribute attribute, glm::ivec2 range)
+{
+    std::vector<AttributeStream>::iterator stream = std::find_if(streams.begin(), streams.end(), [attribute](const AttributeStream &stream)
+                                                                 { return stream.attribute == attribute; });
+    if (stream == streams.end())
+        return;
+    // En : Vertices that are not uploaded yet are sent by Update with their new values.
+    // Tr : Henüz yüklenmemiş köşeler yeni değerleriyle Update tarafından gönderilir.
+    range.y = std::min(range.y, stream->uploaded);
+    if (range.x >= range.y || !store.Has(attribute))
+        return;
+    StreamView view = store.View(attribute);
+    GlobalState.BindBuffer(GL_COPY_WRITE_BUFFER, stream->buffer);
+    GlobalState.BufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)range.x * view.stride, (GLsizeiptr)(range.y - range.x) * view.stride, view.data + (GLintptr)range.x * view.stride);
+}
+
+void MeshStream::Rewrite()
+{
+    Rewrite(VertexAttribute::Position, store.TakeDirtyPositions());
+    Rewrite(VertexAttribute::Normal, store.TakeDirtyNormals());
+}
+
+bool MeshStream::IsIdle() const
+{
+    return pending.empty();
+}
+
+GLuint MeshStream::GetVertexArray() const
+{
+    return vertexArray;
+}
+
+int MeshStream::GetIndexCount() const
+{
+    return drawableIndices;
+}
+
+ComponentStore &MeshStream::GetStore()
+{
+    return store;
+}
+
+const std::vector<int> &MeshStream::GetIndices() const
+{
+    return store.indices;
+}
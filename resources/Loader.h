@@ -0,0 +1,128 @@
+// En : This file contains the class and function prototypes for loading scenes in the background and streaming them to the GPU.
+// Tr : Bu dosya, sahneleri arka planda yükleyen ve GPU'ya aktaran sınıf ve fonksiyon prototiplerini içerir.
+#include <GL/glew.h>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+#include "Analyze.h"
+#include "Components.h"
+#include "State.h"
+#include "Memory.h"
+#ifndef LOADER_H
+#define LOADER_H
+
+// En : Vertex attribute locations and component counts shared by every mesh buffer, indexed by VertexAttribute. The object attribute is an integer, the others are floats.
+// Tr : Tüm mesh tamponları tarafından paylaşılan, VertexAttribute ile indekslenen köşe niteliği konumları ve bileşen sayıları. Nesne niteliği tamsayıdır, diğerleri float'tır.
+const GLuint attributeLocations[] = {0, 1, 2, 3, 4};
+const GLuint attributeSizes[] = {3, 3, 3, 2, 1};
+
+// En : Class declaration for the background scene loader. It parses the file on a worker thread and queues finished chunks.
+// Tr : Arka plan sahne yükleyicisi için sınıf bildirimi. Dosyayı bir işçi iş parçacığında ayrıştırır ve biten parçaları sıraya koyar.
+class SceneLoader
+{
+private:
+    tinyxml2::XMLDocument document;
+    std::thread worker;
+    std::mutex mutex;
+    std::deque<MeshChunk> chunks;
+    std::atomic<int> loadedTags{0}, totalTags{0};
+    std::atomic<bool> finished{false};
+    // En : The document keeps the text of the file while the loader lives, the chunks are accounted until they are taken.
+    // Tr : Belge, yükleyici yaşadığı sürece dosyanın metnini tutar, parçalar alınana kadar hesaplanır.
+    MemoryAccount documentMemory{MemoryCategory::Parse}, chunkMemory{MemoryCategory::Parse};
+    long long chunkBytes = 0;
+
+public:
+    SceneLoader(const char *path, int chunkSize = 1 << 16);
+    ~SceneLoader();
+    // En : Take the next finished chunk. Returns false if there is none yet.
+    // Tr : Sıradaki bitmiş parçayı al. Henüz yoksa false döndürür.
+    bool Poll(MeshChunk &chunk);
+    // En : True when the file is parsed and every chunk is taken.
+    // Tr : Dosya ayrıştırıldığında ve tüm parçalar alındığında true.
+    bool IsFinished();
+    // En : Fraction of the predefined tags that are parsed.
+    // Tr : Ayrıştırılmış önceden tanımlanmış etiketlerin oranı.
+    float GetProgress() const;
+};
+
+// En : Class declaration for a mesh that grows chunk by chunk. Every attribute has its own vertex buffer. Uploads go through a staging ring guarded by fences, so the render thread never waits on a transfer.
+// Tr : Parça parça büyüyen bir mesh için sınıf bildirimi. Her niteliğin kendi köşe tamponu vardır. Yüklemeler çitlerle korunan bir ara tampon halkasından geçer, böylece çizim iş parçacığı hiçbir aktarımı beklemez.
+// En : With ARB_buffer_storage the buffers are immutable and persistently mapped instead, chunks are written straight into the mapping on every core and no staging ring is used.
+// Tr : ARB_buffer_storage ile tamponlar bunun yerine değişmez ve kalıcı olarak eşlenmiştir, parçalar her çekirdekte doğrudan eşlemeye yazılır ve ara tampon halkası kullanılmaz.
+// En : The CPU copy is kept only for the attributes in the shadow mask, and for the indices if the mask is not empty. The other attributes are released once they are uploaded.
+// Tr : CPU kopyası yalnızca gölge maskesindeki nitelikler için ve maske boş değilse indisler için tutulur. Diğer nitelikler yüklendikten sonra serbest bırakılır.
+class MeshStream
+{
+private:
+    struct StagingRegion
+    {
+        GLsync fence;
+        int begin, end;
+    };
+    // En : A pushed chunk. Data holds the attributes that are not in the shadow mask until they are uploaded.
+    // Tr : Eklenmiş bir parça. Data, gölge maskesinde olmayan nitelikleri yüklenene kadar tutar.
+    struct PendingChunk
+    {
+        VertexStreams data;
+        int vertexBegin, vertexEnd, indexBegin, indexEnd;
+    };
+    // En : Capacities and byte offsets are GLsizeiptr, buffers may grow past what an int can address. Uploaded is a vertex count.
+    // Tr : Kapasiteler ve bayt konumları GLsizeiptr'dir, tamponlar bir int'in adresleyebileceğinden fazla büyüyebilir. Uploaded bir köşe sayısıdır.
+    struct AttributeStream
+    {
+        VertexAttribute attribute;
+        GLuint buffer;
+        GLsizeiptr capacity;
+        int uploaded;
+        char *mapping;
+    };
+    GLuint vertexArray = 0, elementBuffer = 0, stagingBuffer = 0;
+    std::vector<AttributeStream> streams;
+    GLsizeiptr indexCapacity = 0;
+    char *indexMapping = nullptr;
+    int vertexCount = 0, indexCount = 0;
+    int uploadedIndices = 0, drawableIndices = 0;
+    int stagingSize, stagingHead = 0;
+    bool persistent;
+    unsigned int shadow;
+    std::deque<StagingRegion> regions;
+    std::deque<PendingChunk> pending;
+    // En : CPU copies of the shadowed attributes and the indices.
+    // Tr : Gölgelenen niteliklerin ve indislerin CPU kopyaları.
+    ComponentStore store;
+    // En : The CPU copy and the queued chunks are accounted as geometry.
+    // Tr : CPU kopyası ve sıradaki parçalar geometri olarak hesaplanır.
+    MemoryAccount memory{MemoryCategory::Geometry};
+    long long pendingBytes = 0;
+    bool Stage(const void *data, int bytes, int &offset);
+    bool Upload(GLuint &buffer, GLsizeiptr &capacity, char *&mapping, GLintptr destination, const void *data, int bytes);
+    void SetLayout();
+    void Rewrite(VertexAttribute attribute, glm::ivec2 range);
+
+public:
+    MeshStream(unsigned int shadow = 0, int stagingSize = 4 << 20);
+    ~MeshStream();
+    // En : Move the streams of a chunk into the CPU copy or the upload queue. The other fields of the chunk are left intact.
+    // Tr : Bir parçanın akışlarını CPU kopyasına veya yükleme kuyruğuna taşı. Parçanın diğer alanlarına dokunulmaz.
+    void Push(MeshChunk &chunk);
+    // En : Upload up to byteBudget bytes of the queued chunks. Returns the uploaded byte count.
+    // Tr : Sıradaki parçaların en fazla byteBudget baytını yükle. Yüklenen bayt sayısını döndürür.
+    int Update(int byteBudget);
+    // En : Upload the position and normal ranges that transforms changed. Other attributes are left alone, and so are attributes without a CPU copy.
+    // Tr : Dönüşümlerin değiştirdiği pozisyon ve normal aralıklarını yükle. Diğer niteliklere ve CPU kopyası olmayan niteliklere dokunulmaz.
+    void Rewrite();
+    bool IsIdle() const;
+    GLuint GetVertexArray() const;
+    int GetIndexCount() const;
+    // En : The CPU copy. Only the shadowed attributes are filled, the indices are empty if nothing is shadowed.
+    // Tr : CPU kopyası. Yalnızca gölgelenen nitelikler doludur, hiçbir şey gölgelenmiyorsa indisler boştur.
+    ComponentStore &GetStore();
+    const std::vector<int> &GetIndices() const;
+};
+
+#endif
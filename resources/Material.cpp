@@ -0,0 +1,98 @@
+// En : Definitions of Material.h file.
+// Tr : Material.h dosyasının tanımlamaları.
+#include "Material.h"
+#include <iostream>
+#include <algorithm>
+
+void MaterialTable::MarkDirty(int begin, int end)
+{
+    if (dirtyBegin == dirtyEnd)
+    {
+        dirtyBegin = begin;
+        dirtyEnd = end;
+    }
+    else
+    {
+        dirtyBegin = std::min(dirtyBegin, begin);
+        dirtyEnd = std::max(dirtyEnd, end);
+    }
+    GlobalFrames.RequestRedraw();
+}
+
+void MaterialTable::Append(const MeshChunk &chunk)
+{
+    if (chunk.materials.empty())
+        return;
+    int begin = materials.size();
+    materials.insert(materials.end(), chunk.materials.begin(), chunk.materials.end());
+    MarkDirty(begin, materials.size());
+    memory.Set((long long)materials.capacity() * sizeof(Material));
+}
+
+int MaterialTable::GetCount() const
+{
+    return materials.size();
+}
+
+void MaterialTable::Set(int object, const Material &material)
+{
+    if (object < 0 || object >= (int)materials.size())
+    {
+        std::cout << "Error: invalid object : " << object << ". Material is ignored." << std::endl;
+        return;
+    }
+    if (materials[object].color == material.color)
+        return;
+    materials[object] = material;
+    MarkDirty(object, object + 1);
+}
+
+const Material &MaterialTable::Get(int object) const
+{
+    return materials[object];
+}
+
+void MaterialTable::SetColor(int object, glm::vec3 color)
+{
+    Material material = object >= 0 && object < (int)materials.size() ? materials[object] : Material{glm::vec4(1.0f)};
+    material.color = glm::vec4(color, material.color.w);
+    Set(object, material);
+}
+
+glm::vec3 MaterialTable::GetColor(int object) const
+{
+    return object >= 0 && object < (int)materials.size() ? glm::vec3(materials[object].color) : glm::vec3(1.0f);
+}
+
+void MaterialTable::Upload()
+{
+    if (dirtyBegin == dirtyEnd)
+        return;
+    if (!buffer)
+    {
+        glGenBuffers(1, &buffer);
+        glGenTextures(1, &texture);
+    }
+    GlobalState.BindBuffer(GL_TEXTURE_BUFFER, buffer);
+
+    // En : Grow by doubling. The whole table is uploaded into the new storage.
+    // Tr : İki katına çıkararak büyü. Tüm tablo yeni alana yüklenir.
+    if ((int)materials.size() > capacity)
+    {
+        capacity = std::max((int)materials.size(), 2 * capacity);
+        GlobalState.BufferData(GL_TEXTURE_BUFFER, capacity * sizeof(Material), nullptr, GL_DYNAMIC_DRAW);
+        GlobalState.BindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+        dirtyBegin = 0;
+        dirtyEnd = materials.size();
+    }
+
+    GlobalState.BufferSubData(GL_TEXTURE_BUFFER, dirtyBegin * sizeof(Material), (dirtyEnd - dirtyBegin) * sizeof(Material), &materials[dirtyBegin]);
+    dirtyBegin = dirtyEnd = 0;
+}
+
+void MaterialTable::Bind(GLuint unit)
+{
+    if (texture)
+        GlobalState.BindTexture(GL_TEXTURE_BUFFER, texture, unit);
+}
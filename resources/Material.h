@@ -0,0 +1,46 @@
+// En : This file contains the class prototype for the material table. Every object has one material, the vertices only keep their object index.
+// Tr : Bu dosya, malzeme tablosu için sınıf prototipini içerir. Her nesnenin bir malzemesi vardır, köşeler yalnızca nesne indislerini tutar.
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include "State.h"
+#include "Frames.h"
+#include "Memory.h"
+#include "Analyze.h"
+#ifndef MATERIAL_H
+#define MATERIAL_H
+
+// En : Class declaration for the material table. Materials are indexed like the object matrices of the scene graph and uploaded the same way, into a texture buffer the vertex shaders read with the object attribute.
+// Tr : Malzeme tablosu için sınıf bildirimi. Malzemeler sahne grafiğinin nesne matrisleri gibi indekslenir ve aynı şekilde, köşe gölgelendiricilerinin nesne niteliği ile okuduğu bir doku tamponuna yüklenir.
+// En : Changing the color of an object writes one texel instead of every vertex of the object.
+// Tr : Bir nesnenin rengini değiştirmek, nesnenin her köşesi yerine tek bir teksel yazar.
+class MaterialTable
+{
+private:
+    std::vector<Material> materials;
+    int dirtyBegin = 0, dirtyEnd = 0;
+    GLuint buffer = 0, texture = 0;
+    int capacity = 0;
+    MemoryAccount memory{MemoryCategory::Objects};
+    void MarkDirty(int begin, int end);
+
+public:
+    // En : Add the materials of a chunk produced by AnalyzeTag. Their indices are the object indices of the chunk.
+    // Tr : AnalyzeTag tarafından üretilen bir parçanın malzemelerini ekle. İndisleri parçanın nesne indisleridir.
+    void Append(const MeshChunk &chunk);
+    int GetCount() const;
+
+    void Set(int object, const Material &material);
+    const Material &Get(int object) const;
+    void SetColor(int object, glm::vec3 color);
+    glm::vec3 GetColor(int object) const;
+
+    // En : Upload the changed materials and bind the texture buffer to a texture unit.
+    // Tr : Değişen malzemeleri yükle ve doku tamponunu bir doku birimine bağla.
+    void Upload();
+    void Bind(GLuint unit);
+};
+
+MaterialTable GlobalMaterials;
+
+#endif
@@ -0,0 +1,87 @@
+// En : Definitions of Memory.h file.
+// Tr : Memory.h dosyasının tanımlamaları.
+#include "Memory.h"
+#include <cstdio>
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const char *MemoryCategoryNames[] = {"Parse", "Geometry", "Objects", "Text", "GL buffers", "GL textures"};
+
+void RaisePeak(std::atomic<long long> &peak, long long value)
+{
+    long long seen = peak.load(std::memory_order_relaxed);
+    while (value > seen && !peak.compare_exchange_weak(seen, value, std::memory_order_relaxed))
+        ;
+}
+
+void MemoryTracker::Add(MemoryCategory category, long long bytes)
+{
+    if (!bytes)
+        return;
+    RaisePeak(peak[(int)category], current[(int)category].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    RaisePeak(totalPeak, total.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+long long MemoryTracker::GetCurrent(MemoryCategory category) const
+{
+    return current[(int)category].load(std::memory_order_relaxed);
+}
+
+long long MemoryTracker::GetPeak(MemoryCategory category) const
+{
+    return peak[(int)category].load(std::memory_order_relaxed);
+}
+
+long long MemoryTracker::GetTotal() const
+{
+    return total.load(std::memory_order_relaxed);
+}
+
+long long MemoryTracker::GetTotalPeak() const
+{
+    return totalPeak.load(std::memory_order_relaxed);
+}
+
+MemoryAccount::MemoryAccount(MemoryCategory category) : category(category)
+{
+}
+
+MemoryAccount::~MemoryAccount()
+{
+    GlobalMemory.Add(category, -bytes);
+}
+
+void MemoryAccount::Set(long long bytes)
+{
+    GlobalMemory.Add(category, bytes - this->bytes);
+    this->bytes = bytes;
+}
+
+long long MemoryAccount::Get() const
+{
+    return bytes;
+}
+
+const char *GetMemoryCategoryName(MemoryCategory category)
+{
+    return MemoryCategoryNames[(int)category];
+}
+
+std::string FormatMemoryReport(const MemoryTracker &tracker, bool detailed)
+{
+    char line[96];
+    if (!detailed)
+    {
+        long long gpu = tracker.GetCurrent(MemoryCategory::GLBuffers) + tracker.GetCurrent(MemoryCategory::GLTextures);
+        std::snprintf(line, sizeof(line), "CPU %.1f MB  GPU %.1f MB  Peak %.1f MB", (tracker.GetTotal() - gpu) / 1048576.0, gpu / 1048576.0, tracker.GetTotalPeak() / 1048576.0);
+        return line;
+    }
+    std::string report;
+    for (int category = 0; category < (int)MemoryCategory::Count; category++)
+    {
+        std::snprintf(line, sizeof(line), "%-12s %10.2f MB  peak %10.2f MB\n", MemoryCategoryNames[category], tracker.GetCurrent((MemoryCategory)category) / 1048576.0, tracker.GetPeak((MemoryCategory)category) / 1048576.0);
+        report += line;
+    }
+    std::snprintf(line, sizeof(line), "%-12s %10.2f MB  peak %10.2f MB", "Total", tracker.GetTotal() / 1048576.0, tracker.GetTotalPeak() / 1048576.0);
+    return report + line;
+}
@@ -0,0 +1,64 @@
+// En : This file contains the class prototypes for memory accounting. Every large CPU array and every GL buffer and texture is counted under a category, so the footprint of a scene can be queried at run time.
+// Tr : Bu dosya, bellek muhasebesi için sınıf prototiplerini içerir. Her büyük CPU dizisi ve her GL tamponu ve dokusu bir kategori altında sayılır, böylece bir sahnenin kapladığı alan çalışma zamanında sorgulanabilir.
+#include <atomic>
+#include <string>
+#ifndef MEMORY_H
+#define MEMORY_H
+
+// En : Parse holds the documents and the chunks waiting for the loader, Geometry the vertex streams on the CPU, Objects the scene graph and the animations, Text the laid out glyphs.
+// Tr : Parse belgeleri ve yükleyiciyi bekleyen parçaları, Geometry CPU üzerindeki köşe akışlarını, Objects sahne grafiğini ve animasyonları, Text yerleştirilmiş glifleri tutar.
+enum class MemoryCategory
+{
+    Parse,
+    Geometry,
+    Objects,
+    Text,
+    GLBuffers,
+    GLTextures,
+    Count
+};
+
+// En : Class declaration for the memory tracker. Counters are atomic, the loader thread accounts while the render thread queries.
+// Tr : Bellek izleyicisi için sınıf bildirimi. Sayaçlar atomiktir, yükleyici iş parçacığı muhasebe yaparken çizim iş parçacığı sorgular.
+class MemoryTracker
+{
+private:
+    std::atomic<long long> current[(int)MemoryCategory::Count] = {}, peak[(int)MemoryCategory::Count] = {};
+    std::atomic<long long> total{0}, totalPeak{0};
+
+public:
+    // En : Add bytes to a category, negative bytes release them.
+    // Tr : Bir kategoriye bayt ekle, negatif baytlar onları serbest bırakır.
+    void Add(MemoryCategory category, long long bytes);
+    long long GetCurrent(MemoryCategory category) const;
+    long long GetPeak(MemoryCategory category) const;
+    long long GetTotal() const;
+    long long GetTotalPeak() const;
+};
+
+MemoryTracker GlobalMemory;
+
+// En : The bytes one owner holds in a category. Set replaces the previous amount, the rest is released when the account is destroyed.
+// Tr : Bir sahibin bir kategoride tuttuğu baytlar. Set önceki miktarın yerine geçer, kalan miktar hesap yok edildiğinde serbest bırakılır.
+class MemoryAccount
+{
+private:
+    MemoryCategory category;
+    long long bytes = 0;
+
+public:
+    explicit MemoryAccount(MemoryCategory category);
+    ~MemoryAccount();
+    MemoryAccount(const MemoryAccount &) = delete;
+    MemoryAccount &operator=(const MemoryAccount &) = delete;
+    void Set(long long bytes);
+    long long Get() const;
+};
+
+const char *GetMemoryCategoryName(MemoryCategory category);
+
+// En : One line with the current CPU and GPU usage and the peak, or one line per category with its peak if detailed is set.
+// Tr : Geçerli CPU ve GPU kullanımı ve en yüksek değerle tek satır, detailed ayarlıysa kategori başına en yüksek değeriyle bir satır.
+std::string FormatMemoryReport(const MemoryTracker &tracker, bool detailed = false);
+
+#endif
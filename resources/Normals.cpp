@@ -0,0 +1,132 @@
+// En : Definitions of Normals.h file.
+// Tr : Normals.h dosyasının tanımlamaları.
+#include "Normals.h"
+#include "Jobs.h"
+#include <vector>
+#include <atomic>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const int NormalBlockSize = 64;
+const int NormalGrain = 1 << 14;
+
+NormalMode ParseNormalMode(const char *name, NormalMode fallback)
+{
+    if (!name)
+        return fallback;
+    std::string mode = name;
+    std::transform(mode.begin(), mode.end(), mode.begin(), tolower);
+    if (mode == "none")
+        return NormalMode::None;
+    if (mode == "flat")
+        return NormalMode::Flat;
+    if (mode == "smooth")
+        return NormalMode::Smooth;
+    if (mode == "angle")
+        return NormalMode::AngleWeighted;
+    return fallback;
+}
+
+glm::vec3 *GenerateNormals(const glm::vec3 *position, int size, const int *index, int indexSize, NormalMode mode)
+{
+    int triangleCount = indexSize / 3;
+    glm::vec3 *output = new glm::vec3[size];
+
+    // En : Every thread accumulates into its own buffer, so no atomics are needed.
+    // Tr : Her iş parçacığı kendi tamponunda biriktirir, bu yüzden atomik işlemlere gerek yoktur.
+    std::vector<std::vector<glm::vec3>> partial(WorkerCount());
+    std::atomic<int> slot{0};
+    ParallelFor(0, triangleCount, NormalGrain, [&](int first, int last)
+                {
+                    std::vector<glm::vec3> &accumulator = partial[slot++];
+                    accumulator.assign(size, glm::vec3(0.0f));
+
+                    // En : Edges are gathered into structure of arrays blocks, so the arithmetic below vectorizes.
+                    // Tr : Kenarlar dizi yapısı bloklarına toplanır, böylece aşağıdaki aritmetik vektörleşir.
+                    float ux[NormalBlockSize], uy[NormalBlockSize], uz[NormalBlockSize];
+                    float vx[NormalBlockSize], vy[NormalBlockSize], vz[NormalBlockSize];
+                    float nx[NormalBlockSize], ny[NormalBlockSize], nz[NormalBlockSize];
+                    float w0[NormalBlockSize], w1[NormalBlockSize], w2[NormalBlockSize];
+                    for (int block = first; block < last; block += NormalBlockSize)
+                    {
+                        int count = std::min(NormalBlockSize, last - block);
+                        for (int i = 0; i < count; i++)
+                        {
+                            const int *t = index + 3 * (block + i);
+                            glm::vec3 a = position[t[0]], u = position[t[1]] - a, v = position[t[2]] - a;
+                            ux[i] = u.x, uy[i] = u.y, uz[i] = u.z;
+                            vx[i] = v.x, vy[i] = v.y, vz[i] = v.z;
+                        }
+                        for (int i = 0; i < count; i++)
+                        {
+                            nx[i] = uy[i] * vz[i] - uz[i] * vy[i];
+                            ny[i] = uz[i] * vx[i] - ux[i] * vz[i];
+                            nz[i] = ux[i] * vy[i] - uy[i] * vx[i];
+                        }
+                        if (mode == NormalMode::AngleWeighted)
+                        {
+                            for (int i = 0; i < count; i++)
+                            {
+                                // En : Corner angles from the edge lengths. The third edge is v - u.
+                                // Tr : Kenar uzunluklarından köşe açıları. Üçüncü kenar v - u'dur.
+                                float wx = vx[i] - ux[i], wy = vy[i] - uy[i], wz = vz[i] - uz[i];
+                                float uu = ux[i] * ux[i] + uy[i] * uy[i] + uz[i] * uz[i];
+                                float vv = vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i];
+                                float ww = wx * wx + wy * wy + wz * wz;
+                                float uv = ux[i] * vx[i] + uy[i] * vy[i] + uz[i] * vz[i];
+                                float uw = ux[i] * wx + uy[i] * wy + uz[i] * wz;
+                                float vw = vx[i] * wx + vy[i] * wy + vz[i] * wz;
+                                float length = std::sqrt(nx[i] * nx[i] + ny[i] * ny[i] + nz[i] * nz[i]);
+                                float inverse = length > 0 ? 1.0f / length : 0.0f;
+                                w0[i] = std::acos(std::clamp(uv / std::sqrt(uu * vv + 1e-30f), -1.0f, 1.0f)) * inverse;
+                                w1[i] = std::acos(std::clamp(-uw / std::sqrt(uu * ww + 1e-30f), -1.0f, 1.0f)) * inverse;
+                                w2[i] = std::acos(std::clamp(vw / std::sqrt(vv * ww + 1e-30f), -1.0f, 1.0f)) * inverse;
+                            }
+                        }
+                        else
+                        {
+                            // En : The unnormalized cross product is already weighted by area.
+                            // Tr : Normalleştirilmemiş vektörel çarpım zaten alana göre ağırlıklıdır.
+                            for (int i = 0; i < count; i++)
+                                w0[i] = w1[i] = w2[i] = 1.0f;
+                        }
+                        for (int i = 0; i < count; i++)
+                        {
+                            const int *t = index + 3 * (block + i);
+                            glm::vec3 n(nx[i], ny[i], nz[i]);
+                            accumulator[t[0]] += n * w0[i];
+                            accumulator[t[1]] += n * w1[i];
+                            accumulator[t[2]] += n * w2[i];
+                        }
+                    } });
+
+    int slots = slot;
+    ParallelFor(0, size, NormalGrain, [&](int first, int last)
+                {
+                    for (int i = first; i < last; i++)
+                    {
+                        glm::vec3 sum(0.0f);
+                        for (int s = 0; s < slots; s++)
+                            sum += partial[s][i];
+                        float length = glm::length(sum);
+                        output[i] = length > 0 ? sum / length : glm::vec3(0.0f, 1.0f, 0.0f);
+                    } });
+    return output;
+}
+
+void UnweldTriangles(glm::vec3 *&position, int &size, int *&index, int indexSize)
+{
+    glm::vec3 *unwelded = new glm::vec3[indexSize];
+    int *sequence = new int[indexSize];
+    for (int i = 0; i < indexSize; i++)
+    {
+        unwelded[i] = position[index[i]];
+        sequence[i] = i;
+    }
+    position = unwelded;
+    index = sequence;
+    size = indexSize;
+}
@@ -0,0 +1,33 @@
+// En : This file contains the function prototypes for generating vertex normals.
+// Tr : Bu dosya, köşe normallerini oluşturan fonksiyonların prototiplerini içerir.
+#include <glm/glm.hpp>
+#ifndef NORMALS_H
+#define NORMALS_H
+
+// En : Flat gives every triangle its own vertices. Smooth weights face normals by area, AngleWeighted by the corner angle.
+// Tr : Flat her üçgene kendi köşelerini verir. Smooth yüz normallerini alana, AngleWeighted köşe açısına göre ağırlıklandırır.
+enum class NormalMode
+{
+    None,
+    Flat,
+    Smooth,
+    AngleWeighted
+};
+
+// En : Normal mode used by AnalyzeTag. It stays None unless the mesh shader reads the normal attribute.
+// Tr : AnalyzeTag tarafından kullanılan normal modu. Mesh gölgelendiricisi normal niteliğini okumadıkça None kalır.
+NormalMode GlobalNormalMode = NormalMode::None;
+
+// En : Parse a mode name ("flat", "smooth", "angle"). Unknown names return the fallback.
+// Tr : Bir mod adını ayrıştır ("flat", "smooth", "angle"). Bilinmeyen adlar yedek değeri döndürür.
+NormalMode ParseNormalMode(const char *name, NormalMode fallback);
+
+// En : Generate normals for an indexed triangle list. Triangles are processed in blocks on every core and summed per thread.
+// Tr : İndeksli bir üçgen listesi için normaller oluştur. Üçgenler her çekirdekte bloklar halinde işlenir ve iş parçacığı başına toplanır.
+glm::vec3 *GenerateNormals(const glm::vec3 *position, int size, const int *index, int indexSize, NormalMode mode);
+
+// En : Give every triangle its own three vertices, so that flat normals do not blend across faces.
+// Tr : Düz normaller yüzler arasında karışmasın diye her üçgene kendi üç köşesini ver.
+void UnweldTriangles(glm::vec3 *&position, int &size, int *&index, int indexSize);
+
+#endif
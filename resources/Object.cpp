@@ -2,15 +2,17 @@
 // Tr : Analyze.h dosyasının tanımlamaları.
 #include "Object.h"
 #include <vector>
-#include <numeric>
-#include <glm/gtx/rotate_vector.hpp>
-Object::Object(int begin, int end) : begin(begin), end(end)
+Object::Object(int begin, int end) : begin(begin), end(end), id(GlobalObejcts.size())
 {
     // En : All object must be added to the global object list.
     // Tr : Tüm nesneler global nesne listesine eklenmelidir.
     GlobalObejcts.push_back(this);
+    GlobalMemory.Add(MemoryCategory::Objects, sizeof(Object));
+}
+Object::~Object()
+{
+    GlobalMemory.Add(MemoryCategory::Objects, -(long long)sizeof(Object));
 }
-Object::~Object() {}
 int Object::GetBegin() const
 {
     return begin;
@@ -19,97 +21,91 @@ int Object::GetEnd() const
 {
     return end;
 }
+void Object::SetIndexRange(int begin, int end) noexcept
+{
+    indexBegin = begin;
+    indexEnd = end;
+}
+int Object::GetIndexBegin() const
+{
+    return indexBegin;
+}
+int Object::GetIndexEnd() const
+{
+    return indexEnd;
+}
+void Object::SetShader(Shader *shader) noexcept
+{
+    this->shader = shader;
+}
+Shader *Object::GetShader() const
+{
+    return shader;
+}
+unsigned int Object::GetVersion() const
+{
+    return version;
+}
 glm::vec3 Object::GetPosition(int index) const
 {
-    int temp = index * Interval + positionIndex;
-    float x = GlobalData[temp],
-          y = GlobalData[temp + 1],
-          z = GlobalData[temp + 2];
-    return glm::vec3(x, y, z);
+    return GlobalStore->positions[index];
 }
 glm::vec3 Object::GetColor(int index) const
 {
-    int temp = index * Interval + colorIndex;
-    float r = GlobalData[temp],
-          g = GlobalData[temp + 1],
-          b = GlobalData[temp + 2];
-    return glm::vec3(r, g, b);
+    // En : The drawn color is the vertex color, white without gradients, times the material color.
+    // Tr : Çizilen renk, gradyan yoksa beyaz olan köşe rengi ile malzeme renginin çarpımıdır.
+    glm::vec3 color = GlobalStore->colors.empty() ? glm::vec3(1.0f) : GlobalStore->colors[index];
+    return color * GlobalMaterials.GetColor(id);
 }
 glm::vec3 Object::GetNormal(int index) const
 {
-    int temp = index * Interval + normalIndex;
-    float x = GlobalData[temp],
-          y = GlobalData[temp + 1],
-          z = GlobalData[temp + 2];
-    return glm::vec3(x, y, z);
+    return GlobalStore->normals.empty() ? glm::vec3(0.0f) : GlobalStore->normals[index];
 }
 glm::vec2 Object::GetUV(int index) const
 {
-    int temp = index * Interval + uvIndex;
-    float u = GlobalData[temp],
-          v = GlobalData[temp + 1];
-    return glm::vec2(u, v);
+    return GlobalStore->uvs.empty() ? glm::vec2(0.0f) : GlobalStore->uvs[index];
+}
+int Object::GetId() const
+{
+    return id;
+}
+void Object::SetColor(glm::vec3 value) noexcept
+{
+    GlobalMaterials.SetColor(id, value);
 }
 void Object::Move(glm::vec3 value) noexcept
 {
-    for (int i = begin * Interval; i < end * Interval; i += Interval)
-    {
-        GlobalData[i + positionIndex] += value.x;
-        GlobalData[i + positionIndex + 1] += value.y;
-        GlobalData[i + positionIndex + 2] += value.z;
-    }
+    TranslatePositions(&GlobalStore->positions[begin], end - begin, value);
+    GlobalStore->MarkPositions(begin, end);
+    version = ++GlobalDataVersion;
+    GlobalFrames.RequestRedraw();
 }
 void Object::Rotate(glm::vec3 value) noexcept
 {
-    // En : Get the positions of the object at the defined indices.
-    // Tr : Nesnenin tanımlanan indislerindeki pozisyonlarını al.
-    std::vector<glm::vec3> positions;
-    for (int i = begin * Interval; i < end * Interval; i += Interval)
-    {
-        float x = GlobalData[i + positionIndex],
-              y = GlobalData[i + positionIndex + 1],
-              z = GlobalData[i + positionIndex + 2];
-        positions.push_back(glm::vec3(x, y, z));
-    }
-    // En : Get the center of the object by points.
-    // Tr : Nesnenin merkezini noktalardan al.
-    glm::vec3 center = std::accumulate(positions.begin(), positions.end(), glm::vec3(0)) / static_cast<float>(positions.size());
-    for (glm::vec3 &position : positions)
+    // En : Rotate the positions around the center of the object by points. Normals follow the same rotation.
+    // Tr : Pozisyonları nesnenin noktalardan alınan merkezi etrafında döndür. Normaller aynı dönmeyi izler.
+    glm::mat3 rotation = EulerRotation(value);
+    glm::vec3 center = Centroid(&GlobalStore->positions[begin], end - begin);
+    TransformPositions(&GlobalStore->positions[begin], end - begin, rotation, center);
+    GlobalStore->MarkPositions(begin, end);
+    if (!GlobalStore->normals.empty())
     {
-        position -= center;
-        position = glm::rotateX(position, glm::radians(value.x));
-        position = glm::rotateY(position, glm::radians(value.y));
-        position = glm::rotateZ(position, glm::radians(value.z));
-        position += center;
-    }
-    for (int i = begin * Interval, j = 0; i < end * Interval; i += Interval, j++)
-    {
-        GlobalData[i + positionIndex] = positions[j].x;
-        GlobalData[i + positionIndex + 1] = positions[j].y;
-        GlobalData[i + positionIndex + 2] = positions[j].z;
+        TransformNormals(&GlobalStore->normals[begin], end - begin, rotation);
+        GlobalStore->MarkNormals(begin, end);
     }
+    version = ++GlobalDataVersion;
+    GlobalFrames.RequestRedraw();
 }
 void Object::Scale(glm::vec3 value) noexcept
 {
-    std::vector<glm::vec3> positions;
-    for (int i = begin * Interval; i < end * Interval; i += Interval)
-    {
-        float x = GlobalData[i + positionIndex],
-              y = GlobalData[i + positionIndex + 1],
-              z = GlobalData[i + positionIndex + 2];
-        positions.push_back(glm::vec3(x, y, z));
-    }
-    glm::vec3 center = std::accumulate(positions.begin(), positions.end(), glm::vec3(0)) / static_cast<float>(positions.size());
-    for (glm::vec3 &position : positions)
+    glm::vec3 center = Centroid(&GlobalStore->positions[begin], end - begin);
+    TransformPositions(&GlobalStore->positions[begin], end - begin, glm::mat3(value.x, 0, 0, 0, value.y, 0, 0, 0, value.z), center);
+    GlobalStore->MarkPositions(begin, end);
+    if (!GlobalStore->normals.empty())
     {
-        position -= center;
-        position *= value;
-        position += center;
+        TransformNormals(&GlobalStore->normals[begin], end - begin, glm::mat3(1.0f / value.x, 0, 0, 0, 1.0f / value.y, 0, 0, 0, 1.0f / value.z));
+        GlobalStore->MarkNormals(begin, end);
     }
-    for (int i = begin * Interval, j = 0; i < end * Interval; i += Interval, j++)
-    {
-        GlobalData[i + positionIndex] = positions[j].x;
-        GlobalData[i + positionIndex + 1] = positions[j].y;
-        GlobalData[i + positionIndex + 2] = positions[j].z;
-    }
-}
\ No newline at end of file
+    version = ++GlobalDataVersion;
+    GlobalFrames.RequestRedraw();
+}
@@ -6,14 +6,19 @@
 #include <tuple>
 #include <functional>
 #include <vector>
+#include "Components.h"
+#include "Frames.h"
+#include "Memory.h"
+#include "Material.h"
 
 // En : These are the global variables that will be used in the program.
 // Tr : Bu, programda kullanılacak olan global değişkenlerdir.
-float *GlobalData;
-int GlobalDataElementSize;
-int LastIndex = 0;
-int Interval = 11;
+ComponentStore *GlobalStore = nullptr;
+// En : Increased on every mutation of GlobalStore, so that derived data (e.g. BVH) can tell what is stale.
+// Tr : GlobalStore her değiştiğinde artırılır, böylece türetilmiş veriler (örn. BVH) neyin eskidiğini anlayabilir.
+unsigned int GlobalDataVersion = 0;
 class Object;
+class Shader;
 std::vector<Object *> GlobalObejcts;
 
 // En : Class declaration for the object model.
@@ -24,10 +29,11 @@ class Object
     // TODO: Add the option of center preference.
     // TODO: Add name as string as member and option.
     // TODO: Add tranform values as member.
-    // TODO: Add optional individual shader for the object.
 private:
-    int positionIndex = 0, colorIndex = 3, normalIndex = 6, uvIndex = 9;
-    int begin, end;
+    int begin, end, id;
+    int indexBegin = 0, indexEnd = 0;
+    Shader *shader = nullptr;
+    unsigned int version = 0;
 
 public:
     // En : Constructor and desconstructor for the object model.
@@ -40,12 +46,31 @@ public:
     int GetBegin() const;
     int GetEnd() const;
 
+    // En : Set and get the range of the object in the scene wide index buffer. Draw packets are built from it.
+    // Tr : Nesnenin sahne genelindeki index tamponundaki aralığını ata ve al. Çizim paketleri bundan oluşturulur.
+    void SetIndexRange(int begin, int end) noexcept;
+    int GetIndexBegin() const;
+    int GetIndexEnd() const;
+
+    // En : Set and get the individual shader of the object. Nullptr means the default mesh shader.
+    // Tr : Nesnenin kendine ait gölgelendiricisini ata ve al. Nullptr varsayılan mesh gölgelendiricisi demektir.
+    void SetShader(Shader *shader) noexcept;
+    Shader *GetShader() const;
+
+    // En : Get the value of GlobalDataVersion at the last mutation of the object.
+    // Tr : Nesnenin son değişimindeki GlobalDataVersion değerini al.
+    unsigned int GetVersion() const;
+
     // En : Get the position, color, normal and uv values of the object.
     // Tr : Nesnenin pozisyon, renk, normal ve uv değerlerini al.
     glm::vec3 GetPosition(int index) const;
     glm::vec3 GetColor(int index) const;
     glm::vec3 GetNormal(int index) const;
     glm::vec2 GetUV(int index) const;
+    // En : Get the index of the object, which is also the index of its matrix and material. Set the color of its material, the vertices are not touched.
+    // Tr : Nesnenin indisini al, bu aynı zamanda matrisinin ve malzemesinin indisidir. Malzemesinin rengini ata, köşelere dokunulmaz.
+    int GetId() const;
+    void SetColor(glm::vec3 value) noexcept;
     void Move(glm::vec3 value) noexcept;
     void Rotate(glm::vec3 value) noexcept;
     void Scale(glm::vec3 value) noexcept;
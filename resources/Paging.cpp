@@ -0,0 +1,478 @@
+// En : Definitions of Paging.h file.
+// Tr : Paging.h dosyasının tanımlamaları.
+#include "Paging.h"
+#include <iostream>
+#include <algorithm>
+#include <cfloat>
+#include <utility>
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const int PagingRequests = 4;
+const float PagingHidden = 1000.0f;
+
+// En : Bytes of one vertex of an attribute in the page file and in the buffers.
+// Tr : Bir niteliğin bir köşesinin sayfa dosyasındaki ve tamponlardaki baytları.
+int PageStride(int attribute)
+{
+    return attributeSizes[attribute] * 4;
+}
+
+// En : Spread the lower 10 bits of a value to every third bit.
+// Tr : Bir değerin alt 10 bitini her üçüncü bite yay.
+unsigned int PageSpreadBits(unsigned int value)
+{
+    value = (value * 0x00010001u) & 0xFF0000FFu;
+    value = (value * 0x00000101u) & 0x0F00F00Fu;
+    value = (value * 0x00000011u) & 0xC30C30C3u;
+    value = (value * 0x00000005u) & 0x49249249u;
+    return value;
+}
+
+unsigned int PageMortonCode(glm::vec3 point)
+{
+    glm::vec3 cell = glm::clamp(point * 1023.0f, glm::vec3(0.0f), glm::vec3(1023.0f));
+    return PageSpreadBits((unsigned int)cell.x) << 2 | PageSpreadBits((unsigned int)cell.y) << 1 | PageSpreadBits((unsigned int)cell.z);
+}
+
+// En : Resize an attribute of the streams to count vertices and return its bytes, for reading a page.
+// Tr : Akışların bir niteliğini count köşeye boyutlandır ve baytlarını döndür, bir sayfayı okumak için.
+char *PageResize(VertexStreams &data, VertexAttribute attribute, int count)
+{
+    data.Enable(attribute);
+    switch (attribute)
+    {
+    case VertexAttribute::Color:
+        data.colors.resize(count);
+        return (char *)data.colors.data();
+    case VertexAttribute::Normal:
+        data.normals.resize(count);
+        return (char *)data.normals.data();
+    case VertexAttribute::UV:
+        data.uvs.resize(count);
+        return (char *)data.uvs.data();
+    case VertexAttribute::Object:
+        data.objects.resize(count);
+        return (char *)data.objects.data();
+    default:
+        data.positions.resize(count);
+        return (char *)data.positions.data();
+    }
+}
+
+PageWriter::PageWriter(const std::string &path, int pageVertices) : file(path, std::ios::binary | std::ios::trunc), pageVertices(pageVertices)
+{
+    if (!file)
+    {
+        std::cout << "Error: page file could not be created : " << path << std::endl;
+        return;
+    }
+    // En : The page count and the directory offset are written again by Finish.
+    // Tr : Sayfa sayısı ve dizin konumu Finish tarafından yeniden yazılır.
+    unsigned int count = 0;
+    unsigned long long directory = 0;
+    file.write(PageFileMagic, sizeof(PageFileMagic));
+    file.write((const char *)&PageFileVersion, sizeof(PageFileVersion));
+    file.write((const char *)&count, sizeof(count));
+    file.write((const char *)&directory, sizeof(directory));
+}
+
+bool PageWriter::IsOpen() const
+{
+    return file.is_open() && file.good();
+}
+
+void PageWriter::WritePage(const MeshChunk &chunk, const std::vector<int> &elements, const std::vector<char> &moving)
+{
+    PageInfo info = {glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX), (unsigned long long)file.tellp(), 0, 0, 0, 0};
+    for (int attribute = 0; attribute < (int)VertexAttribute::Count; attribute++)
+    {
+        if (!chunk.data.Has((VertexAttribute)attribute))
+            continue;
+        info.attributes |= 1u << attribute;
+        StreamView view = chunk.data.View((VertexAttribute)attribute);
+        for (int element : elements)
+        {
+            glm::ivec2 range = chunk.objects[element] - chunk.vertexBase;
+            file.write(view.data + (long long)range.x * view.stride, (long long)(range.y - range.x) * view.stride);
+        }
+    }
+
+    // En : Indices are rebased from the scene to the page, so they stay small whatever the size of the scene.
+    // Tr : İndisler sahneden sayfaya yeniden tabanlanır, böylece sahnenin boyutu ne olursa olsun küçük kalır.
+    std::vector<unsigned int> indices;
+    for (int element : elements)
+    {
+        glm::ivec2 range = chunk.objects[element] - chunk.vertexBase, indexRange = chunk.objectIndices[element] - chunk.indexBase;
+        for (int i = indexRange.x; i < indexRange.y; i++)
+            indices.push_back(chunk.data.indices[i] - chunk.objects[element].x + info.vertexCount);
+        for (int i = range.x; i < range.y; i++)
+        {
+            info.min = glm::min(info.min, chunk.data.positions[i]);
+            info.max = glm::max(info.max, chunk.data.positions[i]);
+        }
+        info.vertexCount += range.y - range.x;
+        info.transformed |= moving[element];
+    }
+    file.write((const char *)indices.data(), (long long)indices.size() * sizeof(unsigned int));
+    info.indexCount = indices.size();
+    pages.push_back(info);
+}
+
+void PageWriter::Write(MeshChunk &chunk)
+{
+    // En : Groups are recorded even for chunks without pages, later chunks may still have elements inside them.
+    // Tr : Gruplar sayfası olmayan parçalar için de kaydedilir, sonraki parçaların hâlâ içlerinde elemanları olabilir.
+    for (const SceneGroup &group : chunk.groups)
+    {
+        bool transformed = group.offset != glm::vec3(0.0f) || group.rotation != glm::vec3(0.0f) || group.scale != glm::vec3(1.0f);
+        transformedGroups.push_back(transformed || (group.parent >= 0 && transformedGroups[group.parent]));
+    }
+    int base = elementBase;
+    elementBase += chunk.objects.size();
+    if (!IsOpen() || chunk.objects.empty() || !chunk.data.Has(VertexAttribute::Position))
+        return;
+
+    // En : Elements moved by their group or an animation are marked, the pages holding them are not culled.
+    // Tr : Grubu veya bir animasyon tarafından hareket ettirilen elemanlar işaretlenir, onları tutan sayfalar ayıklanmaz.
+    std::vector<char> moving(chunk.objects.size());
+    for (int i = 0; i < (int)chunk.objects.size(); i++)
+        moving[i] = transformedGroups[chunk.objectGroups[i]];
+    for (const AnimationData &animation : chunk.animations)
+        moving[animation.object - base] = 1;
+
+    // En : Elements are sorted by the Morton code of their centers within the bounds of the chunk, neighbours on the curve are neighbours in space.
+    // Tr : Elemanlar, parçanın sınırları içindeki merkezlerinin Morton koduna göre sıralanır, eğri üzerindeki komşular uzayda da komşudur.
+    int count = chunk.objects.size();
+    std::vector<glm::vec3> centers(count);
+    glm::vec3 low(FLT_MAX), high(-FLT_MAX);
+    for (int i = 0; i < count; i++)
+    {
+        glm::ivec2 range = chunk.objects[i] - chunk.vertexBase;
+        glm::vec3 min(FLT_MAX), max(-FLT_MAX);
+        for (int j = range.x; j < range.y; j++)
+        {
+            min = glm::min(min, chunk.data.positions[j]);
+            max = glm::max(max, chunk.data.positions[j]);
+        }
+        centers[i] = range.x < range.y ? (min + max) * 0.5f : glm::vec3(0.0f);
+        low = glm::min(low, centers[i]);
+        high = glm::max(high, centers[i]);
+    }
+    glm::vec3 extent = glm::max(high - low, glm::vec3(1e-20f));
+    std::vector<std::pair<unsigned int, int>> codes(count);
+    for (int i = 0; i < count; i++)
+        codes[i] = {PageMortonCode((centers[i] - low) / extent), i};
+    std::sort(codes.begin(), codes.end());
+
+    // En : Consecutive elements are packed until a page is full. An element larger than a page gets a page of its own.
+    // Tr : Ardışık elemanlar bir sayfa dolana kadar paketlenir. Bir sayfadan büyük bir eleman kendi sayfasını alır.
+    std::vector<int> elements;
+    int vertices = 0;
+    for (const std::pair<unsigned int, int> &code : codes)
+    {
+        int size = chunk.objects[code.second].y - chunk.objects[code.second].x;
+        // En : Procedural elements have no vertices to page.
+        // Tr : Prosedürel elemanların sayfalanacak köşeleri yoktur.
+        if (!size)
+            continue;
+        if (!elements.empty() && vertices + size > pageVertices)
+        {
+            WritePage(chunk, elements, moving);
+            elements.clear();
+            vertices = 0;
+        }
+        elements.push_back(code.second);
+        vertices += size;
+    }
+    if (!elements.empty())
+        WritePage(chunk, elements, moving);
+    chunk.data = VertexStreams();
+}
+
+bool PageWriter::Finish()
+{
+    if (!IsOpen())
+        return false;
+    unsigned int count = pages.size();
+    unsigned long long directory = file.tellp();
+    file.write((const char *)pages.data(), (long long)pages.size() * sizeof(PageInfo));
+    file.seekp(sizeof(PageFileMagic) + sizeof(PageFileVersion));
+    file.write((const char *)&count, sizeof(count));
+    file.write((const char *)&directory, sizeof(directory));
+    file.close();
+    return !file.fail();
+}
+
+int PageWriter::GetPageCount() const
+{
+    return pages.size();
+}
+
+PagedScene::PagedScene(const std::string &path, long long budget) : path(path), budget(budget)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(PageFileMagic)] = {};
+    unsigned int version = 0, count = 0;
+    unsigned long long directory = 0;
+    file.read(magic, sizeof(magic));
+    file.read((char *)&version, sizeof(version));
+    file.read((char *)&count, sizeof(count));
+    file.read((char *)&directory, sizeof(directory));
+    if (!file || !std::equal(magic, magic + sizeof(magic), PageFileMagic) || version != PageFileVersion)
+    {
+        std::cout << "Error: invalid page file : " << path << std::endl;
+        return;
+    }
+    std::vector<PageInfo> infos(count);
+    file.seekg(directory);
+    file.read((char *)infos.data(), (long long)count * sizeof(PageInfo));
+    if (!file)
+    {
+        std::cout << "Error: page directory could not be read : " << path << std::endl;
+        return;
+    }
+    pages.resize(count);
+    order.resize(count);
+    for (int i = 0; i < (int)count; i++)
+    {
+        pages[i].info = infos[i];
+        pages[i].bytes = (long long)infos[i].indexCount * sizeof(unsigned int);
+        for (int attribute = 0; attribute < (int)VertexAttribute::Count; attribute++)
+            if (infos[i].attributes & (1u << attribute))
+                pages[i].bytes += (long long)infos[i].vertexCount * PageStride(attribute);
+        order[i] = i;
+    }
+    open = true;
+
+    worker = std::thread([this]()
+                         {
+                             std::ifstream file(this->path, std::ios::binary);
+                             while (true)
+                             {
+                                 int index;
+                                 {
+                                     std::unique_lock<std::mutex> lock(mutex);
+                                     wake.wait(lock, [this]()
+                                               { return stopping || !requests.empty(); });
+                                     if (stopping)
+                                         return;
+                                     index = requests.front();
+                                     requests.pop_front();
+                                 }
+                                 // En : The directory is not changed after the constructor, so it is read without the lock.
+                                 // Tr : Dizin yapıcıdan sonra değişmez, bu yüzden kilit olmadan okunur.
+                                 const PageInfo &info = pages[index].info;
+                                 LoadedPage page{index, VertexStreams()};
+                                 file.seekg(info.offset);
+                                 for (int attribute = 0; attribute < (int)VertexAttribute::Count; attribute++)
+                                     if (info.attributes & (1u << attribute))
+                                         file.read(PageResize(page.data, (VertexAttribute)attribute, info.vertexCount), (long long)info.vertexCount * PageStride(attribute));
+                                 page.data.indices.resize(info.indexCount);
+                                 file.read((char *)page.data.indices.data(), (long long)info.indexCount * sizeof(unsigned int));
+                                 if (!file)
+                                 {
+                                     std::cout << "Error: page could not be read : " << index << ". Accepted as empty." << std::endl;
+                                     file.clear();
+                                     page.data.indices.clear();
+                                 }
+                                 std::lock_guard<std::mutex> lock(mutex);
+                                 loadedBytes += page.data.GetBytes();
+                                 loaded.push_back(std::move(page));
+                             } });
+}
+
+PagedScene::~PagedScene()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (worker.joinable())
+        worker.join();
+    for (Page &page : pages)
+        if (page.state == PageState::Resident)
+            Evict(page);
+}
+
+bool PagedScene::IsOpen() const
+{
+    return open;
+}
+
+void PagedScene::SetBudget(long long bytes)
+{
+    budget = bytes;
+    idle = false;
+}
+
+void PagedScene::Prioritize(const glm::mat4 &viewProjection)
+{
+    // En : The order only changes with the view.
+    // Tr : Sıra yalnızca görünümle değişir.
+    if (ordered && orderedView == viewProjection)
+        return;
+    for (Page &page : pages)
+    {
+        // En : A page is hidden if all corners of its bounds are outside the same clip plane.
+        // Tr : Sınırlarının tüm köşeleri aynı kırpma düzleminin dışındaysa bir sayfa gizlidir.
+        int outside[6] = {};
+        for (int corner = 0; corner < 8; corner++)
+        {
+            glm::vec3 point = glm::vec3(corner & 1 ? page.info.max.x : page.info.min.x, corner & 2 ? page.info.max.y : page.info.min.y, corner & 4 ? page.info.max.z : page.info.min.z);
+            glm::vec4 clip = viewProjection * glm::vec4(point, 1.0f);
+            for (int axis = 0; axis < 3; axis++)
+            {
+                outside[2 * axis] += clip[axis] < -clip.w;
+                outside[2 * axis + 1] += clip[axis] > clip.w;
+            }
+        }
+        bool visible = page.info.transformed || std::none_of(outside, outside + 6, [](int count)
+                                                         { return count == 8; });
+        glm::vec4 center = viewProjection * glm::vec4((page.info.min + page.info.max) * 0.5f, 1.0f);
+        float distance = center.w > 0.0f ? glm::length(glm::vec2(center) / center.w) : PagingHidden;
+        page.priority = visible ? distance : PagingHidden + distance;
+    }
+    std::sort(order.begin(), order.end(), [this](int a, int b)
+              { return pages[a].priority < pages[b].priority; });
+    ordered = true;
+    orderedView = viewProjection;
+    idle = false;
+}
+
+void PagedScene::Upload(Page &page, VertexStreams &data)
+{
+    glGenVertexArrays(1, &page.vertexArray);
+    GlobalState.BindVertexArray(page.vertexArray);
+    for (int attribute = 0; attribute < (int)VertexAttribute::Count; attribute++)
+    {
+        if (!(page.info.attributes & (1u << attribute)))
+            continue;
+        GLuint buffer;
+        glGenBuffers(1, &buffer);
+        GlobalState.BindBuffer(GL_ARRAY_BUFFER, buffer);
+        StreamView view = data.View((VertexAttribute)attribute);
+        GlobalState.BufferData(GL_ARRAY_BUFFER, (GLsizeiptr)view.count * view.stride, view.data, GL_STATIC_DRAW);
+        GLuint location = attributeLocations[attribute];
+        GLuint size = attributeSizes[attribute];
+        if ((VertexAttribute)attribute == VertexAttribute::Object)
+            glVertexAttribIPointer(location, size, GL_INT, size * sizeof(int), (void *)0);
+        else
+            glVertexAttribPointer(location, size, GL_FLOAT, GL_FALSE, size * sizeof(float), (void *)0);
+        glEnableVertexAttribArray(location);
+        page.buffers.push_back(buffer);
+    }
+    glGenBuffers(1, &page.elementBuffer);
+    GlobalState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, page.elementBuffer);
+    GlobalState.BufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)data.indices.size() * sizeof(unsigned int), data.indices.data(), GL_STATIC_DRAW);
+    page.drawCount = data.indices.size();
+    page.state = PageState::Resident;
+    residentBytes += page.bytes;
+}
+
+void PagedScene::Evict(Page &page)
+{
+    for (GLuint buffer : page.buffers)
+        GlobalState.DeleteBuffer(buffer);
+    page.buffers.clear();
+    GlobalState.DeleteBuffer(page.elementBuffer);
+    GlobalState.DeleteVertexArray(page.vertexArray);
+    page.elementBuffer = page.vertexArray = 0;
+    page.drawCount = 0;
+    page.state = PageState::Paged;
+    residentBytes -= page.bytes;
+}
+
+void PagedScene::Update(const glm::mat4 &viewProjection, int byteBudget)
+{
+    if (!open)
+        return;
+    Prioritize(viewProjection);
+
+    // En : Upload the pages the worker has read, up to the byte budget of the frame.
+    // Tr : İşçinin okuduğu sayfaları karenin bayt bütçesine kadar yükle.
+    int uploaded = 0;
+    while (uploaded < byteBudget)
+    {
+        LoadedPage page;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (loaded.empty())
+                break;
+            page = std::move(loaded.front());
+            loaded.pop_front();
+            loadedBytes -= page.data.GetBytes();
+        }
+        Page &target = pages[page.page];
+        loadingBytes -= target.bytes;
+        loadingPages--;
+        Upload(target, page.data);
+        uploaded += target.bytes;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        memory.Set(loadedBytes);
+    }
+
+    // En : Walk the pages in priority order. The pages that fit into the budget are requested, the resident ones that do not are candidates for eviction, worst last.
+    // Tr : Sayfaları öncelik sırasında dolaş. Bütçeye sığan sayfalar istenir, sığmayan yerleşik sayfalar çıkarma adaylarıdır, en kötüsü en sonda.
+    long long wanted = 0;
+    bool waiting = false;
+    std::vector<int> evictable;
+    for (int index : order)
+    {
+        Page &page = pages[index];
+        if (wanted + page.bytes > budget)
+        {
+            if (page.state == PageState::Resident)
+                evictable.push_back(index);
+            continue;
+        }
+        wanted += page.bytes;
+        if (page.state != PageState::Paged)
+            continue;
+        waiting = true;
+        if (loadingPages >= PagingRequests)
+            continue;
+        page.state = PageState::Loading;
+        loadingPages++;
+        loadingBytes += page.bytes;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests.push_back(index);
+        }
+        wake.notify_one();
+    }
+    for (std::vector<int>::reverse_iterator it = evictable.rbegin(); it != evictable.rend() && residentBytes + loadingBytes > budget; ++it)
+        Evict(pages[*it]);
+    idle = !waiting && !loadingPages;
+}
+
+void PagedScene::Submit(RenderQueue &queue, GLuint program)
+{
+    for (const Page &page : pages)
+        if (page.state == PageState::Resident && page.drawCount)
+            queue.Submit(RenderPass::Opaque, program, page.vertexArray, 0, GL_TRIANGLES, 0, page.drawCount, true);
+}
+
+bool PagedScene::IsIdle() const
+{
+    return idle;
+}
+
+int PagedScene::GetPageCount() const
+{
+    return pages.size();
+}
+
+int PagedScene::GetResidentCount() const
+{
+    return std::count_if(pages.begin(), pages.end(), [](const Page &page)
+                         { return page.state == PageState::Resident; });
+}
+
+long long PagedScene::GetResidentBytes() const
+{
+    return residentBytes;
+}
@@ -0,0 +1,136 @@
+// En : This file contains the class prototypes for paging the geometry of scenes larger than memory. The parsed chunks are split into spatial pages in a page file, pages are loaded and evicted by a residency manager.
+// Tr : Bu dosya, bellekten büyük sahnelerin geometrisini sayfalamak için sınıf prototiplerini içerir. Ayrıştırılan parçalar bir sayfa dosyasında uzamsal sayfalara bölünür, sayfalar bir yerleşim yöneticisi tarafından yüklenir ve çıkarılır.
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Analyze.h"
+#include "Loader.h"
+#include "State.h"
+#include "Queue.h"
+#include "Memory.h"
+#ifndef PAGING_H
+#define PAGING_H
+
+// En : Directory entry of a page. Offset is a 64 bit file position, so the page file has no size limit. Indices are local to the page, bounds are taken before the group matrices.
+// Tr : Bir sayfanın dizin girdisi. Offset 64 bitlik bir dosya konumudur, böylece sayfa dosyasının boyut sınırı yoktur. İndisler sayfaya yereldir, sınırlar grup matrislerinden önce alınır.
+// En : Transformed is set if an element of the page is moved by a group or an animation. The bounds of such a page do not hold where it is drawn, so it is always visible.
+// Tr : Sayfanın bir elemanı bir grup veya bir animasyon tarafından hareket ettiriliyorsa transformed ayarlanır. Böyle bir sayfanın sınırları çizildiği yerde geçerli değildir, bu yüzden her zaman görünürdür.
+struct PageInfo
+{
+    glm::vec3 min, max;
+    unsigned long long offset;
+    int vertexCount, indexCount;
+    unsigned int attributes, transformed;
+};
+
+// En : Class declaration for the page file writer. Every chunk is split into pages of nearby elements, ordered along a Morton curve of their centers, so the parser never holds more than one chunk.
+// Tr : Sayfa dosyası yazıcısı için sınıf bildirimi. Her parça, merkezlerinin Morton eğrisi boyunca sıralanmış yakın elemanlardan oluşan sayfalara bölünür, böylece ayrıştırıcı hiçbir zaman birden fazla parça tutmaz.
+// En : The file is a cache of the scene in native byte order: a header, the pages one after another and the directory at the end.
+// Tr : Dosya, yerel bayt sırasında sahnenin bir önbelleğidir: bir başlık, art arda sayfalar ve sonda dizin.
+class PageWriter
+{
+private:
+    std::ofstream file;
+    std::vector<PageInfo> pages;
+    // En : Whether every group so far, or one of its parents, has a transform. Group indices run across the chunks.
+    // Tr : Şimdiye kadarki her grubun veya ebeveynlerinden birinin bir dönüşümü olup olmadığı. Grup indisleri parçalar boyunca sürer.
+    std::vector<char> transformedGroups;
+    int pageVertices, elementBase = 0;
+    void WritePage(const MeshChunk &chunk, const std::vector<int> &elements, const std::vector<char> &moving);
+
+public:
+    PageWriter(const std::string &path, int pageVertices = 1 << 15);
+    bool IsOpen() const;
+    // En : Split the streams of a chunk into pages and release them. The other fields of the chunk are left intact.
+    // Tr : Bir parçanın akışlarını sayfalara böl ve serbest bırak. Parçanın diğer alanlarına dokunulmaz.
+    void Write(MeshChunk &chunk);
+    // En : Write the directory. Returns false if the file could not be written.
+    // Tr : Dizini yaz. Dosya yazılamadıysa false döndürür.
+    bool Finish();
+    int GetPageCount() const;
+};
+
+// En : Class declaration for the residency manager. Pages are read on a worker thread and uploaded on the render thread, every page into its own buffers, so no buffer grows with the scene.
+// Tr : Yerleşim yöneticisi için sınıf bildirimi. Sayfalar bir işçi iş parçacığında okunur ve çizim iş parçacığında, her sayfa kendi tamponlarına yüklenir, böylece hiçbir tampon sahneyle büyümez.
+// En : Visible pages come first, then the pages closest to the center of the view. Pages are loaded in this order while they fit into the budget, the last ones are evicted when they do not.
+// Tr : Önce görünür sayfalar, ardından görünümün merkezine en yakın sayfalar gelir. Sayfalar bütçeye sığdıkları sürece bu sırada yüklenir, sığmadıklarında en sondakiler çıkarılır.
+class PagedScene
+{
+private:
+    enum class PageState
+    {
+        Paged,
+        Loading,
+        Resident
+    };
+    struct Page
+    {
+        PageInfo info;
+        PageState state = PageState::Paged;
+        GLuint vertexArray = 0, elementBuffer = 0;
+        std::vector<GLuint> buffers;
+        int drawCount = 0;
+        long long bytes = 0;
+        float priority = 0;
+    };
+    struct LoadedPage
+    {
+        int page;
+        VertexStreams data;
+    };
+    std::string path;
+    std::vector<Page> pages;
+    std::vector<int> order;
+    long long budget, residentBytes = 0, loadingBytes = 0;
+    int loadingPages = 0;
+    bool open = false, idle = true, ordered = false;
+    glm::mat4 orderedView = glm::mat4(1.0f);
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<int> requests;
+    std::deque<LoadedPage> loaded;
+    long long loadedBytes = 0;
+    bool stopping = false;
+    // En : Pages that are read but not uploaded yet are accounted as geometry, resident pages by the state cache.
+    // Tr : Okunmuş ama henüz yüklenmemiş sayfalar geometri olarak, yerleşik sayfalar durum önbelleği tarafından hesaplanır.
+    MemoryAccount memory{MemoryCategory::Geometry};
+    void Prioritize(const glm::mat4 &viewProjection);
+    void Upload(Page &page, VertexStreams &data);
+    void Evict(Page &page);
+
+public:
+    // En : Budget is the number of bytes the resident pages may take on the GPU.
+    // Tr : Budget, yerleşik sayfaların GPU'da kaplayabileceği bayt sayısıdır.
+    PagedScene(const std::string &path, long long budget);
+    ~PagedScene();
+    bool IsOpen() const;
+    void SetBudget(long long bytes);
+
+    // En : Reorder the pages for the view, request and evict pages and upload up to byteBudget bytes of the pages that were read.
+    // Tr : Sayfaları görünüme göre yeniden sırala, sayfa iste ve çıkar ve okunan sayfaların en fazla byteBudget baytını yükle.
+    void Update(const glm::mat4 &viewProjection, int byteBudget);
+    // En : Submit one draw per resident page.
+    // Tr : Yerleşik sayfa başına bir çizim gönder.
+    void Submit(RenderQueue &queue, GLuint program);
+    // En : True when every page that fits into the budget is resident.
+    // Tr : Bütçeye sığan her sayfa yerleşik olduğunda true.
+    bool IsIdle() const;
+
+    int GetPageCount() const;
+    int GetResidentCount() const;
+    long long GetResidentBytes() const;
+};
+
+// En : Page file header. Version changes whenever the layout of the file does.
+// Tr : Sayfa dosyası başlığı. Dosyanın düzeni her değiştiğinde version değişir.
+const char PageFileMagic[4] = {'S', 'I', 'P', 'G'};
+const unsigned int PageFileVersion = 2;
+
+#endif
@@ -0,0 +1,99 @@
+// En : Definitions of Primitive.h file.
+// Tr : Primitive.h dosyasının tanımlamaları.
+#include "Primitive.h"
+#include <iostream>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const int PrimitiveTexels = 6;
+
+void PrimitiveTable::Append(const MeshChunk &chunk)
+{
+    if (chunk.primitives.empty())
+        return;
+    int begin = records.size();
+    records.reserve(records.size() + chunk.primitives.size() * PrimitiveTexels);
+    for (const Primitive &primitive : chunk.primitives)
+    {
+        for (int i = 0; i < 4; i++)
+            records.push_back(primitive.transform[i]);
+        records.push_back(glm::vec4(primitive.radius, primitive.height, (float)primitive.resolution, (float)(int)primitive.type));
+        // En : The index is stored bit for bit, a float would lose it above 2^24 objects.
+        // Tr : İndis bit bit saklanır, bir float bunu 2^24 nesnenin üstünde kaybederdi.
+        glm::vec4 object(0.0f);
+        std::memcpy(&object.x, &primitive.object, sizeof(int));
+        records.push_back(object);
+        int count = PrimitiveVertexCount(primitive);
+        counts.push_back(count);
+        while ((1 << shift) < count)
+            shift++;
+    }
+    dirtyBegin = dirtyBegin == dirtyEnd ? begin : std::min(dirtyBegin, begin);
+    dirtyEnd = records.size();
+    memory.Set((long long)records.capacity() * sizeof(glm::vec4) + (long long)counts.capacity() * sizeof(int));
+    GlobalFrames.RequestRedraw();
+}
+
+int PrimitiveTable::GetCount() const
+{
+    return counts.size();
+}
+
+int PrimitiveTable::GetShift() const
+{
+    return shift;
+}
+
+void PrimitiveTable::Upload()
+{
+    if (dirtyBegin == dirtyEnd)
+        return;
+    if (!buffer)
+    {
+        glGenBuffers(1, &buffer);
+        glGenTextures(1, &texture);
+        glGenVertexArrays(1, &vertexArray);
+    }
+    GlobalState.BindBuffer(GL_TEXTURE_BUFFER, buffer);
+
+    // En : Grow by doubling. The whole table is uploaded into the new storage.
+    // Tr : İki katına çıkararak büyü. Tüm tablo yeni alana yüklenir.
+    if ((int)records.size() > capacity)
+    {
+        capacity = std::max((int)records.size(), 2 * capacity);
+        GlobalState.BufferData(GL_TEXTURE_BUFFER, capacity * sizeof(glm::vec4), nullptr, GL_DYNAMIC_DRAW);
+        GlobalState.BindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+        dirtyBegin = 0;
+        dirtyEnd = records.size();
+    }
+
+    GlobalState.BufferSubData(GL_TEXTURE_BUFFER, dirtyBegin * sizeof(glm::vec4), (dirtyEnd - dirtyBegin) * sizeof(glm::vec4), &records[dirtyBegin]);
+    dirtyBegin = dirtyEnd = 0;
+}
+
+void PrimitiveTable::Bind(GLuint unit)
+{
+    if (texture)
+        GlobalState.BindTexture(GL_TEXTURE_BUFFER, texture, unit);
+}
+
+void PrimitiveTable::Submit(RenderQueue &queue, GLuint program)
+{
+    if (!vertexArray)
+        return;
+    // En : gl_VertexID is a signed int, primitives whose range would not fit into it are not drawn.
+    // Tr : gl_VertexID işaretli bir int'tir, aralığı buna sığmayacak ilkeller çizilmez.
+    int drawable = std::min((long long)counts.size(), ((long long)INT_MAX + 1) >> shift);
+    if (drawable < (int)counts.size() && !overflowReported)
+    {
+        std::cout << "Error: too many procedural primitives : " << counts.size() << ". Only " << drawable << " are drawn." << std::endl;
+        overflowReported = true;
+    }
+    for (int i = 0; i < drawable; i++)
+        if (counts[i])
+            queue.Submit(RenderPass::Opaque, program, vertexArray, 0, GL_TRIANGLES, i << shift, counts[i], false);
+}
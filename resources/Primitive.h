@@ -0,0 +1,49 @@
+// En : This file contains the class prototype for the procedural primitive table. Circles, cylinders and cones are stored as parameter records and drawn without vertex buffers.
+// Tr : Bu dosya, prosedürel ilkel tablosu için sınıf prototipini içerir. Daireler, silindirler ve koniler parametre kayıtları olarak saklanır ve köşe tamponları olmadan çizilir.
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include "State.h"
+#include "Queue.h"
+#include "Frames.h"
+#include "Memory.h"
+#include "Analyze.h"
+#ifndef PRIMITIVE_H
+#define PRIMITIVE_H
+
+// En : Class declaration for the procedural primitive table. Every primitive is six texels of a texture buffer : the four columns of its transform, (radius, height, resolution, type) and the bits of its object index.
+// Tr : Prosedürel ilkel tablosu için sınıf bildirimi. Her ilkel bir doku tamponunun altı tekselidir : dönüşümünün dört sütunu, (radius, height, resolution, type) ve nesne indisinin bitleri.
+// En : The vertex shader takes the primitive from the high bits of gl_VertexID and the vertex from the low bits, so a draw of primitive i starts at i << shift. The packets of all primitives merge into one draw.
+// Tr : Köşe gölgelendiricisi ilkeli gl_VertexID'nin yüksek bitlerinden, köşeyi düşük bitlerinden alır, böylece i. ilkelin çizimi i << shift'te başlar. Tüm ilkellerin paketleri tek bir çizimde birleşir.
+class PrimitiveTable
+{
+private:
+    std::vector<glm::vec4> records;
+    std::vector<int> counts;
+    int dirtyBegin = 0, dirtyEnd = 0, shift = 0;
+    GLuint buffer = 0, texture = 0, vertexArray = 0;
+    int capacity = 0;
+    bool overflowReported = false;
+    MemoryAccount memory{MemoryCategory::Geometry};
+
+public:
+    // En : Add the primitives of a chunk produced by AnalyzeTag.
+    // Tr : AnalyzeTag tarafından üretilen bir parçanın ilkellerini ekle.
+    void Append(const MeshChunk &chunk);
+    int GetCount() const;
+    // En : Bits of gl_VertexID that select the vertex of a primitive. The shader reads it from the "primitiveShift" uniform.
+    // Tr : gl_VertexID'nin bir ilkelin köşesini seçen bitleri. Gölgelendirici bunu "primitiveShift" uniformundan okur.
+    int GetShift() const;
+
+    // En : Upload the new records and bind the texture buffer to a texture unit.
+    // Tr : Yeni kayıtları yükle ve doku tamponunu bir doku birimine bağla.
+    void Upload();
+    void Bind(GLuint unit);
+    // En : Submit one packet per primitive. The vertex array has no attributes.
+    // Tr : İlkel başına bir paket gönder. Köşe dizisinin niteliği yoktur.
+    void Submit(RenderQueue &queue, GLuint program);
+};
+
+PrimitiveTable GlobalPrimitives;
+
+#endif
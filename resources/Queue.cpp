@@ -0,0 +1,142 @@
+// En : Definitions of Queue.h file.
+// Tr : Queue.h dosyasının tanımlamaları.
+#include "Queue.h"
+#include <algorithm>
+#include <numeric>
+#include <iostream>
+
+unsigned long long MakeSortKey(RenderPass pass, GLuint program, GLuint vertexArray, GLuint texture, float depth)
+{
+    unsigned long long bits = (unsigned long long)(std::clamp(depth, 0.0f, 1.0f) * 0xFFFFFF);
+    if (pass == RenderPass::Transparent)
+        bits = 0xFFFFFF - bits;
+    return ((unsigned long long)pass & 0xF) << 60 |
+           ((unsigned long long)program & 0xFFF) << 48 |
+           ((unsigned long long)vertexArray & 0xFFF) << 36 |
+           ((unsigned long long)texture & 0xFFF) << 24 |
+           bits;
+}
+
+RenderQueue::RenderQueue(int drawThreshold) : drawThreshold(drawThreshold) {}
+
+void RenderQueue::Submit(const DrawPacket &packet)
+{
+    if (packet.count > 0)
+        packets.push_back(packet);
+}
+
+void RenderQueue::Submit(RenderPass pass, GLuint program, GLuint vertexArray, GLuint texture, GLenum mode, int first, int count, bool indexed, float depth)
+{
+    Submit({MakeSortKey(pass, program, vertexArray, texture, depth), program, vertexArray, texture, mode, first, count, indexed});
+}
+
+void RenderQueue::Sort()
+{
+    // En : Least significant digit radix sort on bytes. It is stable, so equal keys keep the submission order.
+    // Tr : Baytlar üzerinde en önemsiz basamaklı taban sıralaması. Kararlıdır, böylece eşit anahtarlar gönderim sırasını korur.
+    int n = packets.size();
+    order.resize(n);
+    scratch.resize(n);
+    std::iota(order.begin(), order.end(), 0);
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        int histogram[257] = {};
+        for (int i = 0; i < n; i++)
+            histogram[((packets[i].key >> shift) & 0xFF) + 1]++;
+        // En : Skip the digit when every key shares it, which is common for the pass and depth bytes.
+        // Tr : Tüm anahtarlar bu basamağı paylaşıyorsa atla, bu geçiş ve derinlik baytları için yaygındır.
+        if (histogram[((packets[0].key >> shift) & 0xFF) + 1] == n)
+            continue;
+        for (int i = 1; i < 257; i++)
+            histogram[i] += histogram[i - 1];
+        for (int i = 0; i < n; i++)
+        {
+            unsigned int packet = order[i];
+            scratch[histogram[(packets[packet].key >> shift) & 0xFF]++] = packet;
+        }
+        order.swap(scratch);
+    }
+}
+
+void RenderQueue::Draw(const DrawPacket &state)
+{
+    GlobalState.UseProgram(state.program);
+    GlobalState.BindVertexArray(state.vertexArray);
+    if (state.texture)
+        GlobalState.BindTexture(GL_TEXTURE_2D, state.texture);
+
+    if (state.indexed)
+    {
+        if (counts.size() == 1)
+        {
+            GlobalState.DrawElements(state.mode, counts[0], GL_UNSIGNED_INT, (const void *)(firsts[0] * sizeof(GLuint)));
+            return;
+        }
+        offsets.resize(counts.size());
+        for (int i = 0; i < (int)counts.size(); i++)
+            offsets[i] = (const void *)(firsts[i] * sizeof(GLuint));
+        GlobalState.MultiDrawElements(state.mode, counts.data(), GL_UNSIGNED_INT, offsets.data(), counts.size());
+    }
+    else if (counts.size() == 1)
+        GlobalState.DrawArrays(state.mode, firsts[0], counts[0]);
+    else
+        GlobalState.MultiDrawArrays(state.mode, firsts.data(), counts.data(), counts.size());
+}
+
+int RenderQueue::Execute()
+{
+    drawCount = 0;
+    if (packets.empty())
+        return 0;
+    Sort();
+
+    int n = packets.size();
+    for (int i = 0; i < n;)
+    {
+        // En : Gather the run sharing the state of its first packet. Adjacent ranges are joined, the rest become one multi draw.
+        // Tr : İlk paketin durumunu paylaşan diziyi topla. Bitişik aralıklar birleştirilir, kalanlar tek bir çoklu çizim olur.
+        const DrawPacket &state = packets[order[i]];
+        firsts.clear();
+        counts.clear();
+        for (; i < n; i++)
+        {
+            const DrawPacket &packet = packets[order[i]];
+            if (packet.program != state.program || packet.vertexArray != state.vertexArray || packet.texture != state.texture ||
+                packet.mode != state.mode || packet.indexed != state.indexed)
+                break;
+            if (!counts.empty() && firsts.back() + counts.back() == packet.first)
+                counts.back() += packet.count;
+            else
+            {
+                firsts.push_back(packet.first);
+                counts.push_back(packet.count);
+            }
+        }
+        Draw(state);
+        drawCount++;
+    }
+    packets.clear();
+
+    if (IsOverThreshold() && !thresholdReported)
+    {
+        std::cout << "Error: draw threshold exceeded : " << drawCount << " > " << drawThreshold << std::endl;
+        thresholdReported = true;
+    }
+    return drawCount;
+}
+
+void RenderQueue::SetDrawThreshold(int drawThreshold) noexcept
+{
+    this->drawThreshold = drawThreshold;
+    thresholdReported = false;
+}
+
+int RenderQueue::GetDrawCount() const
+{
+    return drawCount;
+}
+
+bool RenderQueue::IsOverThreshold() const
+{
+    return drawThreshold && drawCount > drawThreshold;
+}
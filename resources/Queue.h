@@ -0,0 +1,62 @@
+// En : This file contains the class and function prototypes for the render queue. Draws are submitted as packets and executed in sort key order.
+// Tr : Bu dosya, çizim kuyruğu için sınıf ve fonksiyon prototiplerini içerir. Çizimler paket olarak gönderilir ve sıralama anahtarı sırasında yürütülür.
+#include <GL/glew.h>
+#include <vector>
+#include "State.h"
+#ifndef QUEUE_H
+#define QUEUE_H
+
+// En : Passes are executed in this order. Transparent packets are drawn back to front, the others front to back.
+// Tr : Geçişler bu sırada yürütülür. Saydam paketler arkadan öne, diğerleri önden arkaya çizilir.
+enum class RenderPass
+{
+    Opaque,
+    Transparent,
+    Overlay
+};
+
+// En : A single draw. First and count are in indices when indexed, in vertices otherwise.
+// Tr : Tek bir çizim. Indexed ise first ve count indis, değilse köşe cinsindendir.
+struct DrawPacket
+{
+    unsigned long long key;
+    GLuint program, vertexArray, texture;
+    GLenum mode;
+    int first, count;
+    bool indexed;
+};
+
+// En : Build the 64 bit sort key. From the high bits : pass (4), program (12), vertex array (12), texture (12), depth (24).
+// Tr : 64 bitlik sıralama anahtarını oluştur. Yüksek bitlerden : geçiş (4), program (12), köşe dizisi (12), doku (12), derinlik (24).
+unsigned long long MakeSortKey(RenderPass pass, GLuint program, GLuint vertexArray, GLuint texture, float depth);
+
+// En : Class declaration for the render queue. Packets sharing a state are merged into one draw, so the draw count follows the state count.
+// Tr : Çizim kuyruğu için sınıf bildirimi. Aynı durumu paylaşan paketler tek bir çizimde birleştirilir, böylece çizim sayısı durum sayısını izler.
+class RenderQueue
+{
+private:
+    std::vector<DrawPacket> packets;
+    std::vector<unsigned int> order, scratch;
+    std::vector<GLint> firsts;
+    std::vector<GLsizei> counts;
+    std::vector<const void *> offsets;
+    int drawThreshold, drawCount = 0;
+    bool thresholdReported = false;
+    void Sort();
+    void Draw(const DrawPacket &state);
+
+public:
+    // En : The draw threshold is diagnostic only. Every packet is still drawn, a frame with more draws is reported once. Zero means no threshold.
+    // Tr : Çizim eşiği yalnızca tanılama içindir. Her paket yine çizilir, daha fazla çizimi olan bir kare bir kez bildirilir. Sıfır eşik yok demektir.
+    RenderQueue(int drawThreshold = 0);
+    void Submit(const DrawPacket &packet);
+    void Submit(RenderPass pass, GLuint program, GLuint vertexArray, GLuint texture, GLenum mode, int first, int count, bool indexed, float depth = 0.0f);
+    // En : Sort, draw and clear the packets. Returns the draw call count.
+    // Tr : Paketleri sırala, çiz ve temizle. Çizim çağrısı sayısını döndürür.
+    int Execute();
+    void SetDrawThreshold(int drawThreshold) noexcept;
+    int GetDrawCount() const;
+    bool IsOverThreshold() const;
+};
+
+#endif
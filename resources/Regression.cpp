@@ -0,0 +1,612 @@
+// En : Definitions of Regression.h file.
+// Tr : Regression.h dosyasının tanımlamaları.
+#include "Regression.h"
+#include "Analyze.h"
+#include "Loader.h"
+#include "Scene.h"
+#include "Shader.h"
+#include "Queue.h"
+#include "Text.h"
+#include <GLFW/glfw3.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <vector>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <psapi.h>
+#include <malloc.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+std::atomic<long long> RegressionAllocations{0}, RegressionBytes{0};
+const char *RegressionMetrics[] = {"ms", "allocations", "peakKB"};
+const double RegressionDefaultTolerances[] = {0.25, 0.10, 0.15};
+const double RegressionDefaultSlackMs = 0.5;
+
+// En : Every allocation of the benchmark build is counted. Aligned allocations come from the streams, so they are counted too.
+// Tr : Kıyaslama derlemesinin her ayırması sayılır. Hizalı ayırmalar akışlardan gelir, bu yüzden onlar da sayılır.
+void *operator new(std::size_t size)
+{
+    RegressionAllocations.fetch_add(1, std::memory_order_relaxed);
+    RegressionBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void *pointer = std::malloc(size ? size : 1))
+        return pointer;
+    throw std::bad_alloc();
+}
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    RegressionAllocations.fetch_add(1, std::memory_order_relaxed);
+    RegressionBytes.fetch_add(size, std::memory_order_relaxed);
+    std::size_t align = (std::size_t)alignment, rounded = (size + align - 1) / align * align;
+#ifdef _WIN32
+    if (void *pointer = _aligned_malloc(rounded ? rounded : align, align))
+        return pointer;
+#else
+    if (void *pointer = std::aligned_alloc(align, rounded ? rounded : align))
+        return pointer;
+#endif
+    throw std::bad_alloc();
+}
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+int SuiteAttribute(tinyxml2::XMLElement *element, const char *name, int fallback)
+{
+    const char *value = element->Attribute(name);
+    if (!value)
+        return fallback;
+    char *end;
+    long result = std::strtol(value, &end, 10);
+    if (end == value || result <= 0)
+    {
+        std::cout << "Error: invalid " << name << " value : " << value << ". Accepted as " << fallback << "." << std::endl;
+        return fallback;
+    }
+    return (int)result;
+}
+
+// En : Peak resident memory of the process. Linux can reset the peak, so there it belongs to the stage alone, elsewhere it is the peak of the whole run so far.
+// Tr : Sürecin en yüksek yerleşik belleği. Linux en yüksek değeri sıfırlayabilir, bu yüzden orada yalnızca aşamaya aittir, başka yerlerde şimdiye kadarki tüm çalışmanın en yüksek değeridir.
+void ResetPeakMemory()
+{
+#ifdef __linux__
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+long long PeakMemoryKB()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize / 1024;
+#else
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);)
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::atoll(line.c_str() + 6);
+#endif
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#endif
+}
+
+template <typename F>
+StageMeasure MeasureStage(F &&stage)
+{
+    StageMeasure measure;
+    ResetPeakMemory();
+    long long allocations = RegressionAllocations, bytes = RegressionBytes;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    stage();
+    measure.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    measure.allocations = RegressionAllocations - allocations;
+    measure.bytes = RegressionBytes - bytes;
+    measure.peakKB = PeakMemoryKB();
+    return measure;
+}
+
+// En : Repetitions keep the fastest time and the fewest allocations, the peak memory only grows.
+// Tr : Tekrarlar en hızlı süreyi ve en az ayırmayı tutar, en yüksek bellek yalnızca büyür.
+void KeepBest(StageMeasure &best, const StageMeasure &measure, bool first)
+{
+    if (first || measure.milliseconds < best.milliseconds)
+        best.milliseconds = measure.milliseconds;
+    if (first || measure.allocations < best.allocations)
+    {
+        best.allocations = measure.allocations;
+        best.bytes = measure.bytes;
+    }
+    best.peakKB = std::max(best.peakKB, measure.peakKB);
+}
+
+// En : Text of a scene with one <Array> height field of columns x rows quads, written the way a large exported mesh would be: a <Vertex> per vertex and one <indices> list.
+// Tr : columns x rows dörtgenlik tek bir <Array> yükseklik alanına sahip bir sahnenin metni, büyük bir dışa aktarılmış ağın yazılacağı gibi yazılır: köşe başına bir <Vertex> ve tek bir <indices> listesi.
+std::string GenerateArrayScene(int columns, int rows)
+{
+    std::string text = "<root>\n    <Array color=\"ACACFF\">\n        <indices>";
+    char buffer[96];
+    for (int j = 0; j < rows; j++)
+        for (int i = 0; i < columns; i++)
+        {
+            int a = j * (columns + 1) + i, b = a + 1, c = a + columns + 1, d = c + 1;
+            std::snprintf(buffer, sizeof(buffer), "%d,%d,%d,%d,%d,%d,", a, b, d, a, d, c);
+            text += buffer;
+        }
+    text += "</indices>\n";
+    for (int j = 0; j <= rows; j++)
+        for (int i = 0; i <= columns; i++)
+        {
+            float x = 100.0f + 600.0f * i / columns, y = 100.0f + 600.0f * j / rows;
+            std::snprintf(buffer, sizeof(buffer), "        <Vertex x=\"%.2f\" y=\"%.2f\" z=\"%.2f\" />\n", x, y, 20.0f * std::sin(x * 0.05f) * std::cos(y * 0.05f));
+            text += buffer;
+        }
+    return text + "    </Array>\n</root>\n";
+}
+
+void SkipJsonSpaces(const char *&cursor)
+{
+    while (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r')
+        cursor++;
+}
+
+bool ParseJsonObject(const char *&cursor, const std::string &prefix, BaselineValues &values)
+{
+    SkipJsonSpaces(cursor);
+    if (*cursor++ != '{')
+        return false;
+    SkipJsonSpaces(cursor);
+    if (*cursor == '}')
+        return ++cursor, true;
+    while (true)
+    {
+        SkipJsonSpaces(cursor);
+        if (*cursor++ != '"')
+            return false;
+        std::string key;
+        while (*cursor && *cursor != '"')
+            key.push_back(*cursor++);
+        if (*cursor++ != '"')
+            return false;
+        SkipJsonSpaces(cursor);
+        if (*cursor++ != ':')
+            return false;
+        SkipJsonSpaces(cursor);
+        if (*cursor == '{')
+        {
+            if (!ParseJsonObject(cursor, prefix + key + ".", values))
+                return false;
+        }
+        else
+        {
+            char *end;
+            double value = std::strtod(cursor, &end);
+            if (end == cursor)
+                return false;
+            values[prefix + key] = value;
+            cursor = end;
+        }
+        SkipJsonSpaces(cursor);
+        if (*cursor == '}')
+            return ++cursor, true;
+        if (*cursor++ != ',')
+            return false;
+    }
+}
+
+bool ReadBaseline(const std::string &path, BaselineValues &values)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string text = buffer.str();
+    const char *cursor = text.c_str();
+    if (!ParseJsonObject(cursor, "", values))
+    {
+        std::cout << "Error: invalid baseline : " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool WriteBaseline(const std::string &path, const BaselineValues &values)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        std::cout << "Error: baseline could not be written : " << path << std::endl;
+        return false;
+    }
+    // En : The keys are sorted, so the objects open and close as the dotted paths of neighbouring keys diverge.
+    // Tr : Anahtarlar sıralıdır, böylece nesneler komşu anahtarların noktalı yolları ayrıldıkça açılır ve kapanır.
+    std::vector<std::string> open;
+    bool first = true;
+    file << "{";
+    for (const std::pair<const std::string, double> &value : values)
+    {
+        std::vector<std::string> path;
+        std::stringstream key(value.first);
+        for (std::string part; std::getline(key, part, '.');)
+            path.push_back(part);
+        size_t common = 0;
+        while (common < open.size() && common + 1 < path.size() && open[common] == path[common])
+            common++;
+        while (open.size() > common)
+        {
+            open.pop_back();
+            file << "\n" << std::string(2 * open.size() + 2, ' ') << "}";
+        }
+        file << (first ? "" : ",");
+        first = false;
+        for (size_t i = open.size(); i + 1 < path.size(); i++)
+        {
+            file << "\n" << std::string(2 * open.size() + 2, ' ') << "\"" << path[i] << "\": {";
+            open.push_back(path[i]);
+        }
+        char number[32];
+        std::snprintf(number, sizeof(number), "%.6g", value.second);
+        file << "\n" << std::string(2 * open.size() + 2, ' ') << "\"" << path.back() << "\": " << number;
+    }
+    while (!open.empty())
+    {
+        open.pop_back();
+        file << "\n" << std::string(2 * open.size() + 2, ' ') << "}";
+    }
+    file << "\n}\n";
+    return true;
+}
+
+// En : Compare one stage with its baseline and print a line per metric. Returns true on a regression. A stage missing from the baseline has nothing to regress from, it is recorded into the baseline at the end of the run.
+// Tr : Bir aşamayı temel çizgisiyle karşılaştır ve metrik başına bir satır yazdır. Gerilemede true döndürür. Temel çizgide olmayan bir aşamanın gerileyeceği bir şey yoktur, çalışmanın sonunda temel çizgiye kaydedilir.
+bool CompareStage(const std::string &name, const StageMeasure &measure, const BaselineValues &baseline, BaselineValues &results)
+{
+    double values[] = {measure.milliseconds, (double)measure.allocations, (double)measure.peakKB};
+    bool regressed = false;
+    for (int i = 0; i < 3; i++)
+    {
+        std::string key = "scenes." + name + "." + RegressionMetrics[i];
+        results[key] = values[i];
+        char line[160];
+        BaselineValues::const_iterator base = baseline.find(key);
+        if (base == baseline.end())
+        {
+            std::snprintf(line, sizeof(line), "%-24s %-12s %14s -> %14.2f  %8s  no baseline, recording", name.c_str(), RegressionMetrics[i], "-", values[i], "");
+            std::cout << line << std::endl;
+            continue;
+        }
+        BaselineValues::const_iterator tolerance = baseline.find(std::string("tolerance.") + RegressionMetrics[i]);
+        double allowed = base->second * (1.0 + (tolerance != baseline.end() ? tolerance->second : RegressionDefaultTolerances[i]));
+        // En : Short stages are dominated by timer noise, an absolute slack keeps them from failing on nothing.
+        // Tr : Kısa aşamalara zamanlayıcı gürültüsü hakimdir, mutlak bir pay onların boş yere başarısız olmasını önler.
+        if (i == 0)
+        {
+            BaselineValues::const_iterator slack = baseline.find("tolerance.slackMs");
+            allowed += slack != baseline.end() ? slack->second : RegressionDefaultSlackMs;
+        }
+        bool failed = values[i] > allowed;
+        regressed |= failed;
+        double change = base->second > 0 ? 100.0 * (values[i] - base->second) / base->second : 0.0;
+        std::snprintf(line, sizeof(line), "%-24s %-12s %14.2f -> %14.2f  %+7.1f%%  %s", name.c_str(), RegressionMetrics[i], base->second, values[i], change, failed ? "REGRESSION" : "ok");
+        std::cout << line << std::endl;
+    }
+    return regressed;
+}
+
+// En : State of the hidden window the GPU stages draw in.
+// Tr : GPU aşamalarının çizdiği gizli pencerenin durumu.
+struct RegressionContext
+{
+    GLFWwindow *window = nullptr;
+    Shader *meshShader = nullptr, *textShader = nullptr;
+    UniformBuffer *frameUniforms = nullptr;
+    RenderQueue *queue = nullptr;
+};
+
+bool CreateRegressionContext(RegressionContext &context)
+{
+    if (!glfwInit())
+        return false;
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    context.window = glfwCreateWindow(800, 800, "ShapeIt - Benchmark", nullptr, nullptr);
+    if (!context.window)
+        return false;
+    glfwMakeContextCurrent(context.window);
+    if (glewInit() != GLEW_OK)
+        return false;
+    glfwSwapInterval(0);
+    glEnable(GL_CULL_FACE);
+    glCullFace(GL_BACK);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    glm::mat4 projection = glm::ortho(0.0f, 800.0f, 0.0f, 800.0f);
+    context.frameUniforms = new UniformBuffer(0, sizeof(glm::mat4));
+    context.frameUniforms->Update(&projection, sizeof(projection));
+    context.meshShader = new Shader("Shaders\\vertex.vs", "Shaders\\fragment.fs");
+    context.meshShader->SetUniform("objectMatrices", 1);
+    context.meshShader->SetUniform("objectMaterials", 2);
+    if (context.meshShader->UsesAttribute(attributeLocations[(int)VertexAttribute::Normal]))
+        GlobalNormalMode = NormalMode::AngleWeighted;
+
+    FT_Init_FreeType(&ft);
+    GlobalGlyphMode = GlyphMode::SDF;
+    context.textShader = new Shader("Shaders\\text.vs", "Shaders\\text.fs");
+    context.textShader->BindUniformBlock("Frame", context.frameUniforms->GetBinding());
+    context.textShader->SetUniform("textColor", glm::vec3(1.0f));
+    context.textShader->SetUniform("distanceField", 1);
+    context.queue = new RenderQueue();
+    return true;
+}
+
+// En : Draw frames without swapping, so that the display cannot throttle them, and wait for the GPU after each one.
+// Tr : Ekran onları yavaşlatamasın diye kareleri takas etmeden çiz ve her birinden sonra GPU'yu bekle.
+template <typename F>
+void DrawRegressionFrames(RegressionContext &context, int frames, F &&submit)
+{
+    for (int i = 0; i < frames; i++)
+    {
+        GlobalState.BeginFrame();
+        glClear(GL_COLOR_BUFFER_BIT);
+        context.frameUniforms->Bind();
+        submit(*context.queue);
+        context.queue->Execute();
+        glFinish();
+    }
+}
+
+// En : Run a scene: parse it with AnalyzeTag, stream it through a MeshStream and draw frames of it. Every repetition starts from the file again.
+// Tr : Bir sahneyi çalıştır: AnalyzeTag ile ayrıştır, bir MeshStream üzerinden aktar ve karelerini çiz. Her tekrar yeniden dosyadan başlar.
+bool RunRegressionScene(tinyxml2::XMLElement *element, const std::string &directory, RegressionContext *context, const BaselineValues &baseline, BaselineValues &results)
+{
+    std::string name = element->Attribute("name") ? element->Attribute("name") : "scene";
+    std::string path = directory + (element->Attribute("src") ? element->Attribute("src") : "");
+    int repeat = SuiteAttribute(element, "repeat", 3), frames = SuiteAttribute(element, "frames", 60);
+    NormalMode normalMode = GlobalNormalMode;
+    // En : Generated scenes are written once into memory, their parse stage still includes the XML parser.
+    // Tr : Üretilen sahneler belleğe bir kez yazılır, ayrıştırma aşamaları yine XML ayrıştırıcısını içerir.
+    std::string generated;
+    if (element->Attribute("generate"))
+    {
+        if (std::string(element->Attribute("generate")) != "array")
+        {
+            std::cout << "Error: invalid generate value : " << element->Attribute("generate") << ". Accepted as array." << std::endl;
+            return true;
+        }
+        generated = GenerateArrayScene(SuiteAttribute(element, "columns", 512), SuiteAttribute(element, "rows", 512));
+        path = "generated " + name;
+    }
+    StageMeasure parse, upload, draw;
+    for (int run = 0; run < repeat; run++)
+    {
+        std::vector<MeshChunk> chunks;
+        bool loaded = true;
+        StageMeasure measure = MeasureStage([&]()
+                                            {
+                                                tinyxml2::XMLDocument document;
+                                                if (generated.empty())
+                                                    document.LoadFile(path.c_str());
+                                                else
+                                                    document.Parse(generated.c_str(), generated.size());
+                                                tinyxml2::XMLElement *root = document.RootElement();
+                                                if (!root)
+                                                {
+                                                    loaded = false;
+                                                    return;
+                                                }
+                                                GlobalNormalMode = normalMode == NormalMode::None ? normalMode : ParseNormalMode(root->Attribute("normals"), normalMode);
+                                                AnalyzeTag(root, 1 << 16, [&](MeshChunk &chunk)
+                                                           {
+                                                               if (chunk.elementCount)
+                                                                   chunks.push_back(std::move(chunk)); }); });
+        GlobalNormalMode = normalMode;
+        if (!loaded)
+        {
+            std::cout << "Error: scene could not be loaded : " << path << std::endl;
+            return true;
+        }
+        KeepBest(parse, measure, run == 0);
+        if (!context)
+            continue;
+
+        // En : The scene graph and the materials are built only once, they are needed by the frames of the last repetition.
+        // Tr : Sahne grafiği ve malzemeler yalnızca bir kez oluşturulur, bunlara son tekrarın kareleri ihtiyaç duyar.
+        SceneGraph graph;
+        MaterialTable materials;
+        if (run == repeat - 1)
+            for (const MeshChunk &chunk : chunks)
+            {
+                graph.Append(chunk);
+                materials.Append(chunk);
+            }
+        MeshStream *stream = nullptr;
+        measure = MeasureStage([&]()
+                               {
+                                   stream = new MeshStream(1u << (int)VertexAttribute::Position | 1u << (int)VertexAttribute::Object);
+                                   for (MeshChunk &chunk : chunks)
+                                       stream->Push(chunk);
+                                   while (!stream->IsIdle())
+                                       stream->Update(1 << 30);
+                                   glFinish(); });
+        KeepBest(upload, measure, run == 0);
+        if (run == repeat - 1)
+            draw = MeasureStage([&]()
+                                { DrawRegressionFrames(*context, frames, [&](RenderQueue &queue)
+                                                       {
+                                                           graph.Update();
+                                                           graph.Upload();
+                                                           graph.Bind(1);
+                                                           materials.Upload();
+                                                           materials.Bind(2);
+                                                           queue.Submit(RenderPass::Opaque, context->meshShader->GetProgram(), stream->GetVertexArray(), 0, GL_TRIANGLES, 0, stream->GetIndexCount(), true); }); });
+        delete stream;
+    }
+    bool regressed = CompareStage(name + ".parse", parse, baseline, results);
+    if (context)
+    {
+        regressed |= CompareStage(name + ".upload", upload, baseline, results);
+        draw.milliseconds /= std::max(1, frames);
+        regressed |= CompareStage(name + ".frame", draw, baseline, results);
+    }
+    return regressed;
+}
+
+// En : Run a label case: lay out count texts and draw frames of them. Labels need a GPU, their glyphs live in texture atlases.
+// Tr : Bir etiket durumunu çalıştır: count metni yerleştir ve karelerini çiz. Etiketler bir GPU gerektirir, glifleri doku atlaslarında durur.
+bool RunRegressionLabels(tinyxml2::XMLElement *element, RegressionContext *context, const BaselineValues &baseline, BaselineValues &results)
+{
+    std::string name = element->Attribute("name") ? element->Attribute("name") : "labels";
+    if (!context)
+    {
+        std::cout << name << " skipped, no OpenGL context" << std::endl;
+        return false;
+    }
+    int count = SuiteAttribute(element, "count", 1000), size = SuiteAttribute(element, "size", 16), frames = SuiteAttribute(element, "frames", 60);
+    const char *font = element->Attribute("font") ? element->Attribute("font") : "fonts\\unifont-15.1.05.otf";
+    std::vector<Text *> texts;
+    TextBuffer *buffer = nullptr;
+    StageMeasure layout = MeasureStage([&]()
+                                       {
+                                           buffer = new TextBuffer();
+                                           for (int i = 0; i < count; i++)
+                                           {
+                                               std::string content = "Label " + std::to_string(i) + " : x " + std::to_string(i % 40) + ", y " + std::to_string(i / 40);
+                                               Text *text = new Text(content.c_str(), font, size);
+                                               text->SetPosition(glm::vec2(10.0f + (i % 4) * 200.0f, 790.0f - (i / 4 % 50) * 16.0f));
+                                               buffer->Add(text);
+                                               texts.push_back(text);
+                                           }
+                                           buffer->Update();
+                                           glFinish(); });
+    StageMeasure draw = MeasureStage([&]()
+                                     { DrawRegressionFrames(*context, frames, [&](RenderQueue &queue)
+                                                            { buffer->Submit(queue, context->textShader->GetProgram()); }); });
+    draw.milliseconds /= std::max(1, frames);
+    for (Text *text : texts)
+    {
+        buffer->Remove(text);
+        delete text;
+    }
+    delete buffer;
+    bool regressed = CompareStage(name + ".layout", layout, baseline, results);
+    regressed |= CompareStage(name + ".frame", draw, baseline, results);
+    return regressed;
+}
+
+int RunRegressionSuite(int argc, char **argv)
+{
+    std::string suitePath = "benchmarks\\suite.xml";
+    bool update = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string(argv[i]) == "--update-baseline")
+            update = true;
+        else
+            suitePath = argv[i];
+    }
+    tinyxml2::XMLDocument suite;
+    suite.LoadFile(suitePath.c_str());
+    tinyxml2::XMLElement *root = suite.RootElement();
+    if (!root)
+    {
+        std::cout << "Error: suite could not be loaded : " << suitePath << std::endl;
+        return 2;
+    }
+    std::string directory = suitePath.substr(0, suitePath.find_last_of("\\/") + 1);
+    std::string baselinePath = directory + (root->Attribute("baseline") ? root->Attribute("baseline") : "baseline.json");
+    BaselineValues baseline, results;
+    // En : A missing file is an empty baseline. A file that cannot be parsed is never overwritten by the recording.
+    // Tr : Eksik bir dosya boş bir temel çizgidir. Ayrıştırılamayan bir dosyanın üzerine kayıt ile asla yazılmaz.
+    bool exists = std::ifstream(baselinePath).good();
+    bool readable = ReadBaseline(baselinePath, baseline);
+    if (!readable && exists && !update)
+        std::cout << "Error: baseline could not be read : " << baselinePath << ". No stage is compared or recorded." << std::endl;
+
+    // En : Without a window the CPU stages still run, the GPU stages of the baseline are left unchecked.
+    // Tr : Pencere olmadan işlemci aşamaları yine çalışır, temel çizginin GPU aşamaları denetlenmeden bırakılır.
+    RegressionContext context;
+    bool gpu = CreateRegressionContext(context);
+    if (!gpu)
+        std::cout << "Error: OpenGL context could not be created. Only the CPU stages are measured." << std::endl;
+
+    bool regressed = false;
+    for (tinyxml2::XMLElement *element = root->FirstChildElement(); element; element = element->NextSiblingElement())
+    {
+        std::string tag = element->Name();
+        if (tag == "scene")
+            regressed |= RunRegressionScene(element, directory, gpu ? &context : nullptr, baseline, results);
+        else if (tag == "labels")
+            regressed |= RunRegressionLabels(element, gpu ? &context : nullptr, baseline, results);
+        else
+            std::cout << "Error: invalid suite element : " << tag << std::endl;
+    }
+    if (gpu)
+        FT_Done_FreeType(ft);
+    glfwTerminate();
+
+    if (update)
+    {
+        // En : The tolerances are kept, or written with their defaults, so they can be tuned in the file.
+        // Tr : Toleranslar korunur veya varsayılanlarıyla yazılır, böylece dosyada ayarlanabilirler.
+        for (int i = 0; i < 3; i++)
+        {
+            std::string key = std::string("tolerance.") + RegressionMetrics[i];
+            results[key] = baseline.count(key) ? baseline[key] : RegressionDefaultTolerances[i];
+        }
+        results["tolerance.slackMs"] = baseline.count("tolerance.slackMs") ? baseline["tolerance.slackMs"] : RegressionDefaultSlackMs;
+        if (!WriteBaseline(baselinePath, results))
+            return 2;
+        std::cout << "Baseline updated : " << baselinePath << std::endl;
+        return 0;
+    }
+
+    // En : Stages without a baseline are added with their current measures, the stages that have one are left as they are.
+    // Tr : Temel çizgisi olmayan aşamalar mevcut ölçüleriyle eklenir, temel çizgisi olanlara dokunulmaz.
+    int recorded = 0;
+    for (const std::pair<const std::string, double> &value : results)
+        if (!baseline.count(value.first))
+        {
+            baseline[value.first] = value.second;
+            recorded++;
+        }
+    if (recorded && (readable || !exists))
+    {
+        if (WriteBaseline(baselinePath, baseline))
+            std::cout << "Baseline recorded for " << recorded << " metrics : " << baselinePath << std::endl;
+    }
+    std::cout << (regressed ? "Performance regression detected" : "No performance regression") << std::endl;
+    return regressed ? 1 : 0;
+}
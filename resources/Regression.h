@@ -0,0 +1,28 @@
+// En : This file contains the structure and function prototypes for the performance regression suite. Benchmark builds load the canonical scenes of a suite, measure every stage and compare them with a stored baseline.
+// Tr : Bu dosya, performans gerileme paketi için yapı ve fonksiyon prototiplerini içerir. Kıyaslama derlemeleri bir paketin kanonik sahnelerini yükler, her aşamayı ölçer ve saklanan bir temel çizgiyle karşılaştırır.
+#include <map>
+#include <string>
+#ifndef REGRESSION_H
+#define REGRESSION_H
+
+// En : Cost of one stage. Allocations count every operator new on every thread, peakKB is the peak resident memory of the process when the stage ended.
+// Tr : Bir aşamanın maliyeti. Allocations her iş parçacığındaki her operator new çağrısını sayar, peakKB aşama bittiğinde sürecin en yüksek yerleşik belleğidir.
+struct StageMeasure
+{
+    double milliseconds = 0;
+    long long allocations = 0, bytes = 0, peakKB = 0;
+};
+
+// En : Baselines are nested JSON objects of numbers, kept flat with dotted keys, e.g. "scenes.boxes.parse.ms".
+// Tr : Temel çizgiler sayılardan oluşan iç içe JSON nesneleridir, noktalı anahtarlarla düz tutulur, örn. "scenes.boxes.parse.ms".
+typedef std::map<std::string, double> BaselineValues;
+bool ReadBaseline(const std::string &path, BaselineValues &values);
+bool WriteBaseline(const std::string &path, const BaselineValues &values);
+
+// En : Run the suite given on the command line, "benchmarks\suite.xml" by default. "--update-baseline" stores the measures instead of comparing them.
+// Tr : Komut satırında verilen paketi çalıştır, varsayılan "benchmarks\suite.xml". "--update-baseline" ölçüleri karşılaştırmak yerine saklar.
+// En : Returns 0 if every stage is within its tolerance, 1 on a regression and 2 if the suite could not be run. Stages missing from the baseline are recorded into it and do not fail.
+// Tr : Her aşama toleransı içindeyse 0, bir gerilemede 1 ve paket çalıştırılamadıysa 2 döndürür. Temel çizgide olmayan aşamalar ona kaydedilir ve başarısız olmaz.
+int RunRegressionSuite(int argc, char **argv);
+
+#endif
@@ -0,0 +1,223 @@
+// En : Definitions of Scene.h file.
+// Tr : Scene.h dosyasının tanımlamaları.
+#include "Scene.h"
+#include "Components.h"
+#include <iostream>
+#include <algorithm>
+
+glm::mat4 LocalMatrix(glm::vec3 offset, glm::vec3 rotation, glm::vec3 scale)
+{
+    glm::mat3 linear = EulerRotation(rotation);
+    glm::mat4 local(1.0f);
+    for (int i = 0; i < 3; i++)
+        local[i] = glm::vec4(linear[i] * scale[i], 0.0f);
+    local[3] = glm::vec4(offset, 1.0f);
+    return local;
+}
+
+void SceneGraph::MarkDirty(int node)
+{
+    nodes[node].dirty = true;
+    changed = true;
+    GlobalFrames.RequestRedraw();
+}
+
+int SceneGraph::AddNode(int parent, glm::vec3 offset, glm::vec3 rotation, glm::vec3 scale)
+{
+    if (parent >= (int)nodes.size())
+    {
+        std::cout << "Error: invalid parent group : " << parent << ". Accepted as a root." << std::endl;
+        parent = -1;
+    }
+    nodes.push_back({parent, offset, rotation, scale, glm::mat4(1.0f), glm::mat4(1.0f), true, {}});
+    changed = true;
+    Account();
+    return nodes.size() - 1;
+}
+
+int SceneGraph::AddObject(int node)
+{
+    if (node < 0 || node >= (int)nodes.size())
+    {
+        std::cout << "Error: invalid group : " << node << ". Accepted as a new root." << std::endl;
+        node = AddNode(-1);
+    }
+    int object = matrices.size();
+    nodes[node].objects.push_back(object);
+    objectNodes.push_back(node);
+    locals.push_back(glm::mat4(1.0f));
+    matrices.push_back(nodes[node].world);
+    // En : The matrix is already valid if the group is, only the upload is pending.
+    // Tr : Grup geçerliyse matris de zaten geçerlidir, yalnızca yükleme bekler.
+    MarkObjects(object, object + 1);
+    Account();
+    return object;
+}
+
+void SceneGraph::Account()
+{
+    // En : Every object is listed once in the objects of its group.
+    // Tr : Her nesne grubunun nesnelerinde bir kez listelenir.
+    memory.Set((long long)nodes.capacity() * sizeof(SceneNode) + (long long)(matrices.capacity() + locals.capacity()) * sizeof(glm::mat4) +
+               (long long)objectNodes.capacity() * 2 * sizeof(int) + (long long)moved.capacity());
+}
+
+void SceneGraph::Append(const MeshChunk &chunk)
+{
+    for (const SceneGroup &group : chunk.groups)
+        AddNode(group.parent, group.offset, group.rotation, group.scale);
+    for (int group : chunk.objectGroups)
+        AddObject(group);
+}
+
+void SceneGraph::SetOffset(int node, glm::vec3 offset)
+{
+    if (nodes[node].offset == offset)
+        return;
+    nodes[node].offset = offset;
+    MarkDirty(node);
+}
+
+void SceneGraph::SetRotation(int node, glm::vec3 rotation)
+{
+    if (nodes[node].rotation == rotation)
+        return;
+    nodes[node].rotation = rotation;
+    MarkDirty(node);
+}
+
+void SceneGraph::SetScale(int node, glm::vec3 scale)
+{
+    if (nodes[node].scale == scale)
+        return;
+    nodes[node].scale = scale;
+    MarkDirty(node);
+}
+
+glm::vec3 SceneGraph::GetOffset(int node) const
+{
+    return nodes[node].offset;
+}
+
+glm::vec3 SceneGraph::GetRotation(int node) const
+{
+    return nodes[node].rotation;
+}
+
+glm::vec3 SceneGraph::GetScale(int node) const
+{
+    return nodes[node].scale;
+}
+
+int SceneGraph::GetNodeCount() const
+{
+    return nodes.size();
+}
+
+int SceneGraph::GetObjectCount() const
+{
+    return matrices.size();
+}
+
+int SceneGraph::GetObjectNode(int object) const
+{
+    return objectNodes[object];
+}
+
+void SceneGraph::SetObjectLocal(int object, const glm::mat4 &local)
+{
+    locals[object] = local;
+    matrices[object] = nodes[objectNodes[object]].world * local;
+}
+
+void SceneGraph::MarkObjects(int begin, int end)
+{
+    if (begin >= end)
+        return;
+    dirtyBegin = dirtyBegin == dirtyEnd ? begin : std::min(dirtyBegin, begin);
+    dirtyEnd = std::max(dirtyEnd, end);
+    version++;
+    GlobalFrames.RequestRedraw();
+}
+
+void SceneGraph::Update()
+{
+    if (!changed)
+        return;
+    changed = false;
+
+    // En : A group is rebuilt if it changed itself or its parent was rebuilt in this pass. Only changed groups rebuild their local matrix, their descendants cost one product each.
+    // Tr : Bir grup, kendisi değiştiyse veya ebeveyni bu geçişte yeniden oluşturulduysa yeniden oluşturulur. Yalnızca değişen gruplar yerel matrisini yeniden oluşturur, torunları birer çarpıma mal olur.
+    moved.assign(nodes.size(), 0);
+    for (int i = 0; i < (int)nodes.size(); i++)
+    {
+        SceneNode &node = nodes[i];
+        if (!node.dirty && (node.parent < 0 || !moved[node.parent]))
+            continue;
+        if (node.dirty)
+            node.local = LocalMatrix(node.offset, node.rotation, node.scale);
+        node.world = node.parent >= 0 ? nodes[node.parent].world * node.local : node.local;
+        node.dirty = false;
+        moved[i] = 1;
+        for (int object : node.objects)
+        {
+            matrices[object] = node.world * locals[object];
+            dirtyBegin = dirtyBegin == dirtyEnd ? object : std::min(dirtyBegin, object);
+            dirtyEnd = std::max(dirtyEnd, object + 1);
+        }
+    }
+    version++;
+}
+
+const glm::mat4 &SceneGraph::GetWorldMatrix(int node) const
+{
+    return nodes[node].world;
+}
+
+const glm::mat4 &SceneGraph::GetObjectMatrix(int object) const
+{
+    return matrices[object];
+}
+
+const glm::mat4 *SceneGraph::GetObjectMatrices() const
+{
+    return matrices.data();
+}
+
+unsigned int SceneGraph::GetVersion() const
+{
+    return version;
+}
+
+void SceneGraph::Upload()
+{
+    if (dirtyBegin == dirtyEnd)
+        return;
+    if (!buffer)
+    {
+        glGenBuffers(1, &buffer);
+        glGenTextures(1, &texture);
+    }
+    GlobalState.BindBuffer(GL_TEXTURE_BUFFER, buffer);
+
+    // En : Grow by doubling. The whole array is uploaded into the new storage.
+    // Tr : İki katına çıkararak büyü. Tüm dizi yeni alana yüklenir.
+    if ((int)matrices.size() > capacity)
+    {
+        capacity = std::max((int)matrices.size(), 2 * capacity);
+        GlobalState.BufferData(GL_TEXTURE_BUFFER, capacity * sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+        GlobalState.BindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+        dirtyBegin = 0;
+        dirtyEnd = matrices.size();
+    }
+
+    GlobalState.BufferSubData(GL_TEXTURE_BUFFER, dirtyBegin * sizeof(glm::mat4), (dirtyEnd - dirtyBegin) * sizeof(glm::mat4), &matrices[dirtyBegin]);
+    dirtyBegin = dirtyEnd = 0;
+}
+
+void SceneGraph::Bind(GLuint unit)
+{
+    if (texture)
+        GlobalState.BindTexture(GL_TEXTURE_BUFFER, texture, unit);
+}
@@ -0,0 +1,96 @@
+// En : This file contains the class prototype for the scene graph. Container elements of the scene become groups with their own transforms.
+// Tr : Bu dosya, sahne grafiği için sınıf prototipini içerir. Sahnenin kapsayıcı elemanları kendi dönüşümleri olan gruplara dönüşür.
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include "State.h"
+#include "Frames.h"
+#include "Memory.h"
+#include "Analyze.h"
+#ifndef SCENE_H
+#define SCENE_H
+
+// En : A group of the scene graph. The parent always comes before its children, so a single pass in order propagates the matrices.
+// Tr : Sahne grafiğinin bir grubu. Ebeveyn her zaman çocuklarından önce gelir, böylece sırayla tek bir geçiş matrisleri yayar.
+struct SceneNode
+{
+    int parent;
+    glm::vec3 offset, rotation, scale;
+    glm::mat4 local, world;
+    bool dirty;
+    std::vector<int> objects;
+};
+
+// En : Class declaration for the scene graph. World matrices are rebuilt lazily, only for the groups that changed and their descendants.
+// Tr : Sahne grafiği için sınıf bildirimi. Dünya matrisleri tembel olarak, yalnızca değişen gruplar ve onların torunları için yeniden oluşturulur.
+// En : Every object gets the world matrix of its group times its own local matrix. The matrices are uploaded in one batch per frame into a texture buffer, which the vertex shaders index with the object attribute.
+// Tr : Her nesne, grubunun dünya matrisi ile kendi yerel matrisinin çarpımını alır. Matrisler her karede tek seferde, köşe gölgelendiricilerinin nesne niteliği ile indekslediği bir doku tamponuna yüklenir.
+class SceneGraph
+{
+private:
+    std::vector<SceneNode> nodes;
+    std::vector<glm::mat4> matrices, locals;
+    std::vector<int> objectNodes;
+    std::vector<char> moved;
+    int dirtyBegin = 0, dirtyEnd = 0;
+    bool changed = false;
+    unsigned int version = 0;
+    GLuint buffer = 0, texture = 0;
+    int capacity = 0;
+    // En : Groups, matrices and object links are accounted as objects, the texture buffer by the state cache.
+    // Tr : Gruplar, matrisler ve nesne bağlantıları nesne olarak hesaplanır, doku tamponu durum önbelleği tarafından.
+    MemoryAccount memory{MemoryCategory::Objects};
+    void MarkDirty(int node);
+    void Account();
+
+public:
+    // En : Add a group under parent, -1 for a root. Rotation is in degrees. Returns the group index.
+    // Tr : parent altına bir grup ekle, kök için -1. Dönme derece cinsindendir. Grup indisini döndürür.
+    int AddNode(int parent, glm::vec3 offset = glm::vec3(0.0f), glm::vec3 rotation = glm::vec3(0.0f), glm::vec3 scale = glm::vec3(1.0f));
+    // En : Add an object to a group. Returns the object index, which is the value of the object attribute of its vertices.
+    // Tr : Bir gruba nesne ekle. Köşelerinin nesne niteliğinin değeri olan nesne indisini döndürür.
+    int AddObject(int node);
+    // En : Add the groups and objects of a chunk produced by AnalyzeTag.
+    // Tr : AnalyzeTag tarafından üretilen bir parçanın gruplarını ve nesnelerini ekle.
+    void Append(const MeshChunk &chunk);
+
+    void SetOffset(int node, glm::vec3 offset);
+    void SetRotation(int node, glm::vec3 rotation);
+    void SetScale(int node, glm::vec3 scale);
+    glm::vec3 GetOffset(int node) const;
+    glm::vec3 GetRotation(int node) const;
+    glm::vec3 GetScale(int node) const;
+    int GetNodeCount() const;
+    int GetObjectCount() const;
+    int GetObjectNode(int object) const;
+
+    // En : Set the local matrix of an object, e.g. from an animation. Different objects may be set from several threads at once, after Update and before MarkObjects.
+    // Tr : Bir nesnenin yerel matrisini ata, örn. bir animasyondan. Farklı nesneler Update'ten sonra ve MarkObjects'ten önce aynı anda birkaç iş parçacığından atanabilir.
+    void SetObjectLocal(int object, const glm::mat4 &local);
+    // En : Queue the objects in [begin, end) for upload after their local matrices were set.
+    // Tr : Yerel matrisleri atandıktan sonra [begin, end) aralığındaki nesneleri yükleme için sıraya koy.
+    void MarkObjects(int begin, int end);
+
+    // En : Propagate the changed transforms. The matrices are valid after this call.
+    // Tr : Değişen dönüşümleri yay. Matrisler bu çağrıdan sonra geçerlidir.
+    void Update();
+    const glm::mat4 &GetWorldMatrix(int node) const;
+    const glm::mat4 &GetObjectMatrix(int object) const;
+    const glm::mat4 *GetObjectMatrices() const;
+    // En : Increased whenever an object matrix changes, so that derived data (e.g. BVH) can tell what is stale.
+    // Tr : Bir nesne matrisi değiştiğinde artırılır, böylece türetilmiş veriler (örn. BVH) neyin eskidiğini anlayabilir.
+    unsigned int GetVersion() const;
+
+    // En : Upload the changed object matrices and bind the texture buffer to a texture unit.
+    // Tr : Değişen nesne matrislerini yükle ve doku tamponunu bir doku birimine bağla.
+    void Upload();
+    void Bind(GLuint unit);
+};
+
+SceneGraph GlobalScene;
+
+// En : Local matrix of a group, offset * rotation * scale. Rotation is in degrees and applied in x, y, z order.
+// Tr : Bir grubun yerel matrisi, öteleme * dönme * ölçek. Dönme derece cinsindendir ve x, y, z sırasında uygulanır.
+glm::mat4 LocalMatrix(glm::vec3 offset, glm::vec3 rotation, glm::vec3 scale);
+
+#endif
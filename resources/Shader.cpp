@@ -1,99 +1,185 @@
 #include "Shader.h"
 #include <fstream>
 #include <iostream>
+#include <filesystem>
+#include <algorithm>
+#include <cstdio>
 
-Shader::Shader(const char *vertexShaderSource, const char *fragmentShaderSource)
+// En : Functions only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan fonksiyonlar.
+std::string ReadShaderFile(const char *path)
 {
-
-    std::ifstream vertexFile, fragmentFile;
-    try
-    {
-        vertexFile.open(vertexShaderSource);
-    }
-    catch (const std::exception &e)
+    // En : The whole file is read in one go.
+    // Tr : Tüm dosya tek seferde okunur.
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
     {
-        std::cout << "Error: vertex shader file not found or valid." << std::endl;
+        std::cout << "Error: shader file not found or valid : " << path << std::endl;
+        return std::string();
     }
-    try
+    std::string code(file.tellg(), '\0');
+    file.seekg(0);
+    file.read(&code[0], code.size());
+    return code;
+}
+
+bool CheckShader(GLuint object, bool program, const char *name)
+{
+    GLint status = GL_FALSE, length = 0;
+    if (program)
     {
-        fragmentFile.open(fragmentShaderSource);
+        glGetProgramiv(object, GL_LINK_STATUS, &status);
+        glGetProgramiv(object, GL_INFO_LOG_LENGTH, &length);
     }
-    catch (const std::exception &e)
+    else
     {
-        std::cout << "Error: fragment shader file not found or valid." << std::endl;
+        glGetShaderiv(object, GL_COMPILE_STATUS, &status);
+        glGetShaderiv(object, GL_INFO_LOG_LENGTH, &length);
     }
+    if (status == GL_TRUE)
+        return true;
+    std::string log(std::max(length, 1), '\0');
+    if (program)
+        glGetProgramInfoLog(object, length, nullptr, &log[0]);
+    else
+        glGetShaderInfoLog(object, length, nullptr, &log[0]);
+    std::cout << "Error: " << name << " failed." << std::endl
+              << log.c_str() << std::endl;
+    return false;
+}
 
-    std::string vertexCode, fragmentCode;
-    std::string line;
-    while (std::getline(vertexFile, line))
+std::string ShaderCachePath(const std::string &vertexCode, const std::string &fragmentCode)
+{
+    if (ShaderCacheDirectory.empty() || !GLEW_ARB_get_program_binary)
+        return std::string();
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (!formats)
+        return std::string();
+
+    // En : 64 bit FNV-1a over the sources and the driver strings. Binaries are only valid for the driver that made them.
+    // Tr : Kaynaklar ve sürücü dizeleri üzerinde 64 bit FNV-1a. İkililer yalnızca onları oluşturan sürücü için geçerlidir.
+    unsigned long long hash = 14695981039346656037ull;
+    auto mix = [&hash](const char *text)
     {
-        vertexCode += line + "\n";
-    }
-    while (std::getline(fragmentFile, line))
+        for (; text && *text; text++)
+            hash = (hash ^ (unsigned char)*text) * 1099511628211ull;
+        hash = (hash ^ 0xff) * 1099511628211ull;
+    };
+    mix(vertexCode.c_str());
+    mix(fragmentCode.c_str());
+    mix((const char *)glGetString(GL_VENDOR));
+    mix((const char *)glGetString(GL_RENDERER));
+    mix((const char *)glGetString(GL_VERSION));
+
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", hash);
+    return ShaderCacheDirectory + "/" + name + ".bin";
+}
+
+Shader::Shader(const char *vertexShaderSource, const char *fragmentShaderSource)
+{
+    std::string vertexCode = ReadShaderFile(vertexShaderSource), fragmentCode = ReadShaderFile(fragmentShaderSource);
+
+    // En : Try the cached binary first and compile from source if it is missing or rejected.
+    // Tr : Önce önbellekteki ikiliyi dene, eksikse veya reddedilirse kaynaktan derle.
+    std::string cachePath = ShaderCachePath(vertexCode, fragmentCode);
+    if (cachePath.empty() || !LoadBinary(cachePath))
     {
-        fragmentCode += line + "\n";
+        if (Compile(vertexCode, fragmentCode) && !cachePath.empty())
+            SaveBinary(cachePath);
     }
+    CacheUniforms();
+}
 
+bool Shader::Compile(const std::string &vertexCode, const std::string &fragmentCode)
+{
     const char *vShaderCode = vertexCode.c_str();
     const char *fShaderCode = fragmentCode.c_str();
 
     vertexShader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertexShader, 1, &vShaderCode, nullptr);
     glCompileShader(vertexShader);
-
-    GLenum error = glGetError();
-    if (error != GL_NO_ERROR)
-    {
-        std::cout << "Error: " << error << std::endl;
-    }
+    bool valid = CheckShader(vertexShader, false, "vertex shader compilation");
 
     fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
     glShaderSource(fragmentShader, 1, &fShaderCode, nullptr);
     glCompileShader(fragmentShader);
-
-    error = glGetError();
-    if (error != GL_NO_ERROR)
-    {
-        std::cout << "Error: " << error << std::endl;
-    }
+    valid = CheckShader(fragmentShader, false, "fragment shader compilation") && valid;
 
     shaderProgram = glCreateProgram();
     glAttachShader(shaderProgram, vertexShader);
+    glAttachShader(shaderProgram, fragmentShader);
+    if (GLEW_ARB_get_program_binary)
+        glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(shaderProgram);
+    valid = valid && CheckShader(shaderProgram, true, "shader program linking");
 
-    error = glGetError();
-    if (error != GL_NO_ERROR)
-    {
-        std::cout << "Error: " << error << std::endl;
-    }
+    glDetachShader(shaderProgram, vertexShader);
+    glDetachShader(shaderProgram, fragmentShader);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    vertexShader = fragmentShader = 0;
+    return valid;
+}
 
-    glAttachShader(shaderProgram, fragmentShader);
+bool Shader::LoadBinary(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+    std::streamsize size = file.tellg();
+    GLenum format;
+    if (size <= (std::streamsize)sizeof(format))
+        return false;
+    std::string binary(size - sizeof(format), '\0');
+    file.seekg(0);
+    file.read((char *)&format, sizeof(format));
+    file.read(&binary[0], binary.size());
 
-    error = glGetError();
-    if (error != GL_NO_ERROR)
-    {
-        std::cout << "Error: " << error << std::endl;
-    }
+    // En : Drivers may reject binaries after an update, the caller compiles from source then.
+    // Tr : Sürücüler bir güncellemeden sonra ikilileri reddedebilir, bu durumda çağıran kaynaktan derler.
+    shaderProgram = glCreateProgram();
+    glProgramBinary(shaderProgram, format, binary.data(), binary.size());
+    GLint status = GL_FALSE;
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &status);
+    if (status == GL_TRUE)
+        return true;
+    glDeleteProgram(shaderProgram);
+    shaderProgram = 0;
+    return false;
+}
 
-    glLinkProgram(shaderProgram);
+void Shader::SaveBinary(const std::string &path) const
+{
+    GLint length = 0;
+    glGetProgramiv(shaderProgram, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+    std::string binary(length, '\0');
+    GLenum format;
+    glGetProgramBinary(shaderProgram, length, nullptr, &format, &binary[0]);
 
-    error = glGetError();
-    if (error != GL_NO_ERROR)
+    std::error_code error;
+    std::filesystem::create_directories(ShaderCacheDirectory, error);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
     {
-        std::cout << "Error: " << error << std::endl;
+        std::cout << "Error: shader cache could not be written : " << path << std::endl;
+        return;
     }
-
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    file.write((const char *)&format, sizeof(format));
+    file.write(binary.data(), binary.size());
 }
 
 Shader::~Shader()
 {
-    glDeleteProgram(shaderProgram);
+    GlobalState.DeleteProgram(shaderProgram);
 }
 
 void Shader::Use()
 {
-    glUseProgram(shaderProgram);
+    GlobalState.UseProgram(shaderProgram);
 }
 
 GLuint Shader::GetProgram() const
@@ -101,81 +187,226 @@ GLuint Shader::GetProgram() const
     return shaderProgram;
 }
 
-void Shader::SetUniform(const char *name, int value)
+bool Shader::UsesAttribute(GLuint location) const
 {
-    Use();
-    int loc = glGetUniformLocation(shaderProgram, name);
-    if (loc == -1)
+    GLint count = 0, length = 0;
+    glGetProgramiv(shaderProgram, GL_ACTIVE_ATTRIBUTES, &count);
+    glGetProgramiv(shaderProgram, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &length);
+    std::string name(length, '\0');
+    for (GLint i = 0; i < count; i++)
     {
-        std::cout << "Error: Uniform not found." << std::endl
-                  << name << std::endl;
+        GLint size;
+        GLenum type;
+        glGetActiveAttrib(shaderProgram, i, length, nullptr, &size, &type, &name[0]);
+        if (glGetAttribLocation(shaderProgram, name.c_str()) == (GLint)location)
+            return true;
     }
-    glUniform1i(loc, value);
+    return false;
 }
-void Shader::SetUniform(const char *name, unsigned int value)
+
+GLint Shader::GetUniformLocation(const char *name)
+{
+    std::unordered_map<std::string, GLint>::iterator it = uniformLocations.find(name);
+    if (it != uniformLocations.end())
+        return it->second;
+    std::cout << "Error: Uniform not found." << std::endl
+              << name << std::endl;
+    uniformLocations[name] = -1;
+    return -1;
+}
+
+void Shader::CacheUniforms()
 {
-    Use();
-    int loc = glGetUniformLocation(shaderProgram, name);
-    if (loc == -1)
+    uniformLocations.clear();
+    GLint count = 0, length = 0;
+    glGetProgramiv(shaderProgram, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(shaderProgram, GL_ACTIVE_UNIFORM_MAX_LENGTH, &length);
+    std::string name(length, '\0');
+    for (GLint i = 0; i < count; i++)
     {
-        std::cout << "Error: Uniform not found." << std::endl
-                  << name << std::endl;
+        GLint size;
+        GLenum type;
+        GLsizei written = 0;
+        glGetActiveUniform(shaderProgram, i, length, &written, &size, &type, &name[0]);
+        std::string uniform = name.substr(0, written);
+        GLint location = glGetUniformLocation(shaderProgram, uniform.c_str());
+        // En : Members of uniform blocks have no location.
+        // Tr : Uniform bloklarının üyelerinin konumu yoktur.
+        if (location == -1)
+            continue;
+        uniformLocations[uniform] = location;
+        // En : Arrays are reported as "name[0]", they are found by "name" too.
+        // Tr : Diziler "name[0]" olarak bildirilir, "name" ile de bulunurlar.
+        if (uniform.size() > 3 && uniform.compare(uniform.size() - 3, 3, "[0]") == 0)
+            uniformLocations[uniform.substr(0, uniform.size() - 3)] = location;
     }
-    glUniform1ui(loc, value);
 }
-void Shader::SetUniform(const char *name, float value)
+
+void Shader::BindUniformBlock(const char *name, GLuint binding)
 {
-    Use();
-    int loc = glGetUniformLocation(shaderProgram, name);
-    if (loc == -1)
+    GLuint index = glGetUniformBlockIndex(shaderProgram, name);
+    if (index == GL_INVALID_INDEX)
     {
-        std::cout << "Error: Uniform not found." << std::endl
+        std::cout << "Error: Uniform block not found." << std::endl
                   << name << std::endl;
+        return;
     }
-    glUniform1f(loc, value);
+    glUniformBlockBinding(shaderProgram, index, binding);
 }
-void Shader::SetUniform(const char *name, glm::vec2 value)
+
+// En : Without separate shader objects the program has to be bound before glUniform*.
+// Tr : Ayrı gölgelendirici nesneleri olmadan program glUniform* öncesinde bağlanmalıdır.
+bool DirectUniforms()
 {
-    Use();
-    int loc = glGetUniformLocation(shaderProgram, name);
-    if (loc == -1)
+    static const bool supported = GLEW_ARB_separate_shader_objects;
+    return supported;
+}
+
+template <>
+void Uniform<int>::Set(const int &value) const
+{
+    if (location == -1)
+        return;
+    if (DirectUniforms())
+        glProgramUniform1i(program, location, value);
+    else
     {
-        std::cout << "Error: Uniform not found." << std::endl
-                  << name << std::endl;
+        GlobalState.UseProgram(program);
+        glUniform1i(location, value);
     }
-    glUniform2f(loc, value.x, value.y);
 }
-void Shader::SetUniform(const char *name, glm::vec3 value)
+template <>
+void Uniform<unsigned int>::Set(const unsigned int &value) const
 {
-    Use();
-    int loc = glGetUniformLocation(shaderProgram, name);
-    if (loc == -1)
+    if (location == -1)
+        return;
+    if (DirectUniforms())
+        glProgramUniform1ui(program, location, value);
+    else
     {
-        std::cout << "Error: Uniform not found." << std::endl
-                  << name << std::endl;
+        GlobalState.UseProgram(program);
+        glUniform1ui(location, value);
     }
-    glUniform3f(loc, value.x, value.y, value.z);
 }
-void Shader::SetUniform(const char *name, glm::vec4 value)
+template <>
+void Uniform<float>::Set(const float &value) const
 {
-    Use();
-    int loc = glGetUniformLocation(shaderProgram, name);
-    if (loc == -1)
+    if (location == -1)
+        return;
+    if (DirectUniforms())
+        glProgramUniform1f(program, location, value);
+    else
     {
-        std::cout << "Error: Uniform not found." << std::endl
-                  << name << std::endl;
+        GlobalState.UseProgram(program);
+        glUniform1f(location, value);
+    }
+}
+template <>
+void Uniform<glm::vec2>::Set(const glm::vec2 &value) const
+{
+    if (location == -1)
+        return;
+    if (DirectUniforms())
+        glProgramUniform2f(program, location, value.x, value.y);
+    else
+    {
+        GlobalState.UseProgram(program);
+        glUniform2f(location, value.x, value.y);
+    }
+}
+template <>
+void Uniform<glm::vec3>::Set(const glm::vec3 &value) const
+{
+    if (location == -1)
+        return;
+    if (DirectUniforms())
+        glProgramUniform3f(program, location, value.x, value.y, value.z);
+    else
+    {
+        GlobalState.UseProgram(program);
+        glUniform3f(location, value.x, value.y, value.z);
+    }
+}
+template <>
+void Uniform<glm::vec4>::Set(const glm::vec4 &value) const
+{
+    if (location == -1)
+        return;
+    if (DirectUniforms())
+        glProgramUniform4f(program, location, value.x, value.y, value.z, value.w);
+    else
+    {
+        GlobalState.UseProgram(program);
+        glUniform4f(location, value.x, value.y, value.z, value.w);
+    }
+}
+template <>
+void Uniform<glm::mat4>::Set(const glm::mat4 &value) const
+{
+    if (location == -1)
+        return;
+    if (DirectUniforms())
+        glProgramUniformMatrix4fv(program, location, 1, GL_FALSE, &value[0][0]);
+    else
+    {
+        GlobalState.UseProgram(program);
+        glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
     }
+}
 
-    glUniform4f(loc, value.x, value.y, value.z, value.w);
+void Shader::SetUniform(const char *name, int value)
+{
+    GetUniform<int>(name).Set(value);
+}
+void Shader::SetUniform(const char *name, unsigned int value)
+{
+    GetUniform<unsigned int>(name).Set(value);
+}
+void Shader::SetUniform(const char *name, float value)
+{
+    GetUniform<float>(name).Set(value);
+}
+void Shader::SetUniform(const char *name, glm::vec2 value)
+{
+    GetUniform<glm::vec2>(name).Set(value);
+}
+void Shader::SetUniform(const char *name, glm::vec3 value)
+{
+    GetUniform<glm::vec3>(name).Set(value);
+}
+void Shader::SetUniform(const char *name, glm::vec4 value)
+{
+    GetUniform<glm::vec4>(name).Set(value);
 }
 void Shader::SetUniform(const char *name, glm::mat4 value)
 {
-    Use();
-    int loc = glGetUniformLocation(shaderProgram, name);
-    if (loc == -1)
-    {
-        std::cout << "Error: Uniform not found." << std::endl
-                  << name << std::endl;
-    };
-    glUniformMatrix4fv(loc, 1, GL_FALSE, &value[0][0]);
-}
\ No newline at end of file
+    GetUniform<glm::mat4>(name).Set(value);
+}
+
+UniformBuffer::UniformBuffer(GLuint binding, int size) : binding(binding), size(size)
+{
+    glGenBuffers(1, &buffer);
+    GlobalState.BindBuffer(GL_UNIFORM_BUFFER, buffer);
+    GlobalState.BufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+}
+
+UniformBuffer::~UniformBuffer()
+{
+    GlobalState.DeleteBuffer(buffer);
+}
+
+void UniformBuffer::Update(const void *data, int size, int offset)
+{
+    GlobalState.BindBuffer(GL_UNIFORM_BUFFER, buffer);
+    GlobalState.BufferSubData(GL_UNIFORM_BUFFER, offset, std::min(size, this->size - offset), data);
+}
+
+void UniformBuffer::Bind() const
+{
+    GlobalState.BindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+}
+
+GLuint UniformBuffer::GetBinding() const
+{
+    return binding;
+}
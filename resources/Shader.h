@@ -2,19 +2,71 @@
 // Tr : Bu dosya, Shader sınıfı için sınıf ve fonksiyon prototiplerini içerir.
 #include <GL/glew.h>
 #include <glm/glm.hpp>
+#include <string>
+#include <unordered_map>
+#include "State.h"
 #ifndef SHADER_H
 #define SHADER_H
 
+// En : Directory of the program binary cache. Leave empty to always compile from source.
+// Tr : Program ikili önbelleğinin dizini. Her zaman kaynaktan derlemek için boş bırak.
+std::string ShaderCacheDirectory = "ShaderCache";
+
+// En : Typed handle of a uniform, resolved once. Set writes through glProgramUniform* where available, so the program is not bound.
+// Tr : Bir kez çözümlenen, tipli bir uniform tutamacı. Set mümkünse glProgramUniform* ile yazar, böylece program bağlanmaz.
+template <typename T>
+struct Uniform
+{
+    GLuint program = 0;
+    GLint location = -1;
+    void Set(const T &value) const;
+    bool IsValid() const { return location != -1; }
+};
+
+// En : Class declaration for a std140 uniform buffer, for uniforms shared across programs. Bind it once per frame.
+// Tr : Programlar arasında paylaşılan uniformlar için std140 uniform tamponu sınıf bildirimi. Her karede bir kez bağla.
+class UniformBuffer
+{
+private:
+    GLuint buffer = 0, binding;
+    int size;
+
+public:
+    UniformBuffer(GLuint binding, int size);
+    ~UniformBuffer();
+    void Update(const void *data, int size, int offset = 0);
+    void Bind() const;
+    GLuint GetBinding() const;
+};
+
 class Shader
 {
 private:
-    GLuint vertexShader, fragmentShader, shaderProgram;
+    GLuint vertexShader = 0, fragmentShader = 0, shaderProgram = 0;
+    // En : Locations of the active uniforms, filled once after linking. Missing names are added as -1 after the first report.
+    // Tr : Etkin uniformların konumları, bağlamadan sonra bir kez doldurulur. Eksik isimler ilk bildirimden sonra -1 olarak eklenir.
+    std::unordered_map<std::string, GLint> uniformLocations;
+    void CacheUniforms();
+    // En : Compile and link from source, or load and store a linked program binary keyed by the source and the driver.
+    // Tr : Kaynaktan derle ve bağla, ya da kaynak ve sürücü ile anahtarlanmış bağlı bir program ikilisini yükle ve sakla.
+    bool Compile(const std::string &vertexCode, const std::string &fragmentCode);
+    bool LoadBinary(const std::string &path);
+    void SaveBinary(const std::string &path) const;
 
 public:
     Shader(const char *vertexShaderSource, const char *fragmentShaderSource);
     ~Shader();
     void Use();
     GLuint GetProgram() const;
+    // En : Check whether the linked program reads the vertex attribute at the given location.
+    // Tr : Bağlanmış programın verilen konumdaki köşe niteliğini okuyup okumadığını kontrol et.
+    bool UsesAttribute(GLuint location) const;
+    GLint GetUniformLocation(const char *name);
+    template <typename T>
+    Uniform<T> GetUniform(const char *name) { return Uniform<T>{shaderProgram, GetUniformLocation(name)}; }
+    // En : Connect a uniform block of the program to the binding point of a UniformBuffer.
+    // Tr : Programın bir uniform bloğunu bir UniformBuffer'ın bağlama noktasına bağla.
+    void BindUniformBlock(const char *name, GLuint binding);
     void SetUniform(const char *name, int value);
     void SetUniform(const char *name, unsigned int value);
     void SetUniform(const char *name, float value);
@@ -0,0 +1,250 @@
+// En : Definitions of State.h file.
+// Tr : State.h dosyasının tanımlamaları.
+#include "State.h"
+
+bool StateCache::Change(bool changed)
+{
+    if (changed)
+        current.stateChanges++;
+    else
+        current.skippedChanges++;
+    return changed;
+}
+
+void StateCache::UseProgram(GLuint program)
+{
+    if (Change(this->program != program))
+    {
+        glUseProgram(program);
+        this->program = program;
+    }
+}
+
+void StateCache::BindVertexArray(GLuint vertexArray)
+{
+    if (Change(this->vertexArray != vertexArray))
+    {
+        glBindVertexArray(vertexArray);
+        this->vertexArray = vertexArray;
+        // En : The element buffer binding belongs to the vertex array.
+        // Tr : Eleman tamponu bağlaması köşe dizisine aittir.
+        buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+    }
+}
+
+void StateCache::BindBuffer(GLenum target, GLuint buffer)
+{
+    std::map<GLenum, GLuint>::iterator it = buffers.find(target);
+    if (Change(it == buffers.end() || it->second != buffer))
+    {
+        glBindBuffer(target, buffer);
+        buffers[target] = buffer;
+    }
+}
+
+void StateCache::BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    std::map<std::pair<GLenum, GLuint>, GLuint>::iterator it = indexedBuffers.find({target, index});
+    if (Change(it == indexedBuffers.end() || it->second != buffer))
+    {
+        glBindBufferBase(target, index, buffer);
+        indexedBuffers[{target, index}] = buffer;
+        // En : Binding to an indexed point also binds the generic target.
+        // Tr : İndeksli bir noktaya bağlamak genel hedefi de bağlar.
+        buffers[target] = buffer;
+    }
+}
+
+void StateCache::BindTexture(GLenum target, GLuint texture, GLuint unit)
+{
+    std::map<std::pair<GLenum, GLuint>, GLuint>::iterator it = textures.find({target, unit});
+    if (!Change(it == textures.end() || it->second != texture))
+        return;
+    if (activeUnit != unit)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        activeUnit = unit;
+    }
+    glBindTexture(target, texture);
+    textures[{target, unit}] = texture;
+}
+
+void StateCache::DeleteProgram(GLuint program)
+{
+    if (this->program == program)
+        this->program = 0;
+    glDeleteProgram(program);
+}
+
+void StateCache::DeleteVertexArray(GLuint vertexArray)
+{
+    if (this->vertexArray == vertexArray)
+    {
+        this->vertexArray = 0;
+        buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+    }
+    glDeleteVertexArrays(1, &vertexArray);
+}
+
+void StateCache::DeleteBuffer(GLuint buffer)
+{
+    for (std::map<GLenum, GLuint>::iterator it = buffers.begin(); it != buffers.end();)
+        it = it->second == buffer ? buffers.erase(it) : ++it;
+    for (std::map<std::pair<GLenum, GLuint>, GLuint>::iterator it = indexedBuffers.begin(); it != indexedBuffers.end();)
+        it = it->second == buffer ? indexedBuffers.erase(it) : ++it;
+    std::map<GLuint, long long>::iterator bytes = bufferBytes.find(buffer);
+    if (bytes != bufferBytes.end())
+    {
+        GlobalMemory.Add(MemoryCategory::GLBuffers, -bytes->second);
+        bufferBytes.erase(bytes);
+    }
+    glDeleteBuffers(1, &buffer);
+}
+
+void StateCache::DeleteTexture(GLuint texture)
+{
+    for (std::map<std::pair<GLenum, GLuint>, GLuint>::iterator it = textures.begin(); it != textures.end();)
+        it = it->second == texture ? textures.erase(it) : ++it;
+    std::map<GLuint, long long>::iterator bytes = textureBytes.find(texture);
+    if (bytes != textureBytes.end())
+    {
+        GlobalMemory.Add(MemoryCategory::GLTextures, -bytes->second);
+        textureBytes.erase(bytes);
+    }
+    glDeleteTextures(1, &texture);
+}
+
+void StateCache::DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    if (!count)
+        return;
+    glDrawElements(mode, count, type, indices);
+    current.drawCalls++;
+}
+
+void StateCache::DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    if (!count)
+        return;
+    glDrawArrays(mode, first, count);
+    current.drawCalls++;
+}
+
+void StateCache::MultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei drawCount)
+{
+    if (!drawCount)
+        return;
+    glMultiDrawElements(mode, count, type, indices, drawCount);
+    current.drawCalls++;
+}
+
+void StateCache::MultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawCount)
+{
+    if (!drawCount)
+        return;
+    glMultiDrawArrays(mode, first, count, drawCount);
+    current.drawCalls++;
+}
+
+void StateCache::SetBufferBytes(GLenum target, long long bytes)
+{
+    std::map<GLenum, GLuint>::iterator bound = buffers.find(target);
+    if (bound == buffers.end())
+        return;
+    long long &tracked = bufferBytes[bound->second];
+    GlobalMemory.Add(MemoryCategory::GLBuffers, bytes - tracked);
+    tracked = bytes;
+}
+
+void StateCache::BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    glBufferData(target, size, data, usage);
+    SetBufferBytes(target, size);
+    if (data)
+        current.bytesUploaded += size;
+}
+
+void StateCache::BufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    glBufferStorage(target, size, data, flags);
+    SetBufferBytes(target, size);
+    if (data)
+        current.bytesUploaded += size;
+}
+
+void StateCache::TexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data)
+{
+    glTexImage2D(target, level, internalFormat, width, height, 0, format, type, data);
+    std::map<std::pair<GLenum, GLuint>, GLuint>::iterator bound = textures.find({target, activeUnit});
+    if (bound == textures.end())
+        return;
+    int texel;
+    switch (internalFormat)
+    {
+    case GL_R8:
+        texel = 1;
+        break;
+    case GL_RG8:
+    case GL_R16F:
+        texel = 2;
+        break;
+    case GL_RGB8:
+        texel = 3;
+        break;
+    case GL_RGBA16F:
+        texel = 8;
+        break;
+    case GL_RGBA32F:
+        texel = 16;
+        break;
+    default:
+        texel = 4;
+    }
+    // En : Level 0 replaces the storage, the other levels are added to it.
+    // Tr : 0. seviye alanın yerine geçer, diğer seviyeler ona eklenir.
+    long long bytes = (long long)width * height * texel, &tracked = textureBytes[bound->second];
+    if (level == 0)
+        bytes -= tracked;
+    GlobalMemory.Add(MemoryCategory::GLTextures, bytes);
+    tracked += bytes;
+    if (data)
+        current.bytesUploaded += (long long)width * height * texel;
+}
+
+void StateCache::BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    glBufferSubData(target, offset, size, data);
+    current.bytesUploaded += size;
+}
+
+void StateCache::CountUpload(long long bytes)
+{
+    current.bytesUploaded += bytes;
+}
+
+void StateCache::Invalidate()
+{
+    program = vertexArray = activeUnit = 0;
+    buffers.clear();
+    indexedBuffers.clear();
+    textures.clear();
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void StateCache::BeginFrame()
+{
+    last = current;
+    current = FrameStats();
+}
+
+const FrameStats &StateCache::GetFrameStats() const
+{
+    return last;
+}
+
+std::string FormatFrameStats(const FrameStats &stats)
+{
+    return "Draws " + std::to_string(stats.drawCalls) +
+           "  State " + std::to_string(stats.stateChanges) + " (" + std::to_string(stats.skippedChanges) + " skipped)" +
+           "  Upload " + std::to_string(stats.bytesUploaded / 1024) + " KB";
+}
@@ -0,0 +1,79 @@
+// En : This file contains the class prototype for the GL state cache. Every program, vertex array, buffer and texture bind goes through it.
+// Tr : Bu dosya, GL durum önbelleği için sınıf prototipini içerir. Her program, köşe dizisi, tampon ve doku bağlama işlemi bundan geçer.
+#include <GL/glew.h>
+#include <map>
+#include <string>
+#include <utility>
+#include "Memory.h"
+#ifndef STATE_H
+#define STATE_H
+
+// En : Counters of a frame. Skipped binds are the ones that would not have changed anything.
+// Tr : Bir karenin sayaçları. Atlanan bağlamalar hiçbir şeyi değiştirmeyecek olanlardır.
+struct FrameStats
+{
+    int drawCalls = 0;
+    int stateChanges = 0;
+    int skippedChanges = 0;
+    long long bytesUploaded = 0;
+};
+
+// En : Class declaration for the GL state cache.
+// Tr : GL durum önbelleği için sınıf bildirimi.
+class StateCache
+{
+private:
+    GLuint program = 0, vertexArray = 0, activeUnit = 0;
+    std::map<GLenum, GLuint> buffers;
+    std::map<std::pair<GLenum, GLuint>, GLuint> indexedBuffers;
+    std::map<std::pair<GLenum, GLuint>, GLuint> textures;
+    FrameStats current, last;
+    // En : Sizes of the buffer and texture storages created through the cache, counted in GlobalMemory.
+    // Tr : Önbellek üzerinden oluşturulan tampon ve doku alanlarının boyutları, GlobalMemory içinde sayılır.
+    std::map<GLuint, long long> bufferBytes, textureBytes;
+    bool Change(bool changed);
+    void SetBufferBytes(GLenum target, long long bytes);
+
+public:
+    void UseProgram(GLuint program);
+    void BindVertexArray(GLuint vertexArray);
+    void BindBuffer(GLenum target, GLuint buffer);
+    void BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+    void BindTexture(GLenum target, GLuint texture, GLuint unit = 0);
+
+    // En : Deleting through the cache forgets the name, so that a reused name is bound again.
+    // Tr : Önbellek üzerinden silmek ismi unutturur, böylece yeniden kullanılan bir isim tekrar bağlanır.
+    void DeleteProgram(GLuint program);
+    void DeleteVertexArray(GLuint vertexArray);
+    void DeleteBuffer(GLuint buffer);
+    void DeleteTexture(GLuint texture);
+
+    // En : Draws and uploads are counted. Storage created with BufferData, BufferStorage and TexImage2D is accounted to the bound buffer or texture until it is deleted through the cache.
+    // Tr : Çizimler ve yüklemeler sayılır. BufferData, BufferStorage ve TexImage2D ile oluşturulan alan, önbellek üzerinden silinene kadar bağlı tampona veya dokuya yazılır.
+    void DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
+    void DrawArrays(GLenum mode, GLint first, GLsizei count);
+    void MultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei drawCount);
+    void MultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawCount);
+    void BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+    void BufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+    void TexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data);
+    void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+    void CountUpload(long long bytes);
+
+    // En : Forget every cached binding, e.g. after code outside the cache changed the state.
+    // Tr : Önbellekteki tüm bağlamaları unut, örn. önbellek dışındaki bir kod durumu değiştirdikten sonra.
+    void Invalidate();
+
+    // En : Start a new frame. GetFrameStats returns the counters of the last finished frame.
+    // Tr : Yeni bir kare başlat. GetFrameStats son biten karenin sayaçlarını döndürür.
+    void BeginFrame();
+    const FrameStats &GetFrameStats() const;
+};
+
+StateCache GlobalState;
+
+// En : One line summary of the counters, e.g. for the window title or the overlay.
+// Tr : Sayaçların tek satırlık özeti, örn. pencere başlığı veya kaplama için.
+std::string FormatFrameStats(const FrameStats &stats);
+
+#endif
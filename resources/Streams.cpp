@@ -0,0 +1,84 @@
+// En : Definitions of Streams.h file.
+// Tr : Streams.h dosyasının tanımlamaları.
+#include "Streams.h"
+#include <type_traits>
+
+void VertexStreams::Enable(VertexAttribute attribute)
+{
+    enabled |= 1u << (int)attribute;
+}
+
+bool VertexStreams::Has(VertexAttribute attribute) const
+{
+    return enabled & (1u << (int)attribute);
+}
+
+int VertexStreams::GetSize() const
+{
+    // En : Every enabled array has the same length, positions may be left out of a partial copy.
+    // Tr : Etkin her dizi aynı uzunluktadır, kısmi bir kopyada pozisyonlar dışarıda bırakılmış olabilir.
+    for (int attribute = 0; attribute < (int)VertexAttribute::Count; attribute++)
+        if (Has((VertexAttribute)attribute))
+            return View((VertexAttribute)attribute).count;
+    return 0;
+}
+
+long long VertexStreams::GetBytes() const
+{
+    return (long long)(positions.capacity() + colors.capacity() + normals.capacity()) * sizeof(glm::vec3) +
+           (long long)uvs.capacity() * sizeof(glm::vec2) + (long long)(objects.capacity() + indices.capacity()) * sizeof(int);
+}
+
+StreamView VertexStreams::View(VertexAttribute attribute) const
+{
+    switch (attribute)
+    {
+    case VertexAttribute::Color:
+        return {(const char *)colors.data(), sizeof(glm::vec3), (int)colors.size()};
+    case VertexAttribute::Normal:
+        return {(const char *)normals.data(), sizeof(glm::vec3), (int)normals.size()};
+    case VertexAttribute::UV:
+        return {(const char *)uvs.data(), sizeof(glm::vec2), (int)uvs.size()};
+    case VertexAttribute::Object:
+        return {(const char *)objects.data(), sizeof(int), (int)objects.size()};
+    default:
+        return {(const char *)positions.data(), sizeof(glm::vec3), (int)positions.size()};
+    }
+}
+
+void VertexStreams::Append(VertexStreams &other, unsigned int mask, bool indices)
+{
+    // En : An attribute the other streams do not have is padded with zeros, so that every array keeps one element per vertex.
+    // Tr : Diğer akışlarda olmayan bir nitelik sıfırlarla doldurulur, böylece her dizi köşe başına bir eleman tutar.
+    bool empty = GetSize() == 0;
+    int size = GetSize(), added = other.GetSize();
+    if (empty)
+        enabled = other.enabled & mask;
+    auto append = [&](auto &target, auto &source, VertexAttribute attribute)
+    {
+        if (!(mask & (1u << (int)attribute)))
+            return;
+        if (empty)
+            target = std::move(source);
+        else if (Has(attribute))
+        {
+            if (other.Has(attribute))
+                target.insert(target.end(), source.begin(), source.end());
+            target.resize(size + added);
+        }
+        std::remove_reference_t<decltype(source)>().swap(source);
+    };
+    append(positions, other.positions, VertexAttribute::Position);
+    append(colors, other.colors, VertexAttribute::Color);
+    append(normals, other.normals, VertexAttribute::Normal);
+    append(uvs, other.uvs, VertexAttribute::UV);
+    append(objects, other.objects, VertexAttribute::Object);
+    if (indices)
+    {
+        if (this->indices.empty())
+            this->indices = std::move(other.indices);
+        else
+            this->indices.insert(this->indices.end(), other.indices.begin(), other.indices.end());
+        std::vector<int>().swap(other.indices);
+    }
+}
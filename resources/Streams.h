@@ -0,0 +1,94 @@
+// En : This file contains the class prototype for vertex streams. Every attribute is a typed, contiguous array, streams are moved between the parser, the loader and the component store instead of copied.
+// Tr : Bu dosya, köşe akışları için sınıf prototipini içerir. Her nitelik tipli, bitişik bir dizidir, akışlar ayrıştırıcı, yükleyici ve bileşen deposu arasında kopyalanmak yerine taşınır.
+#include <glm/glm.hpp>
+#include <vector>
+#include <new>
+#ifndef STREAMS_H
+#define STREAMS_H
+
+// En : Allocator that aligns the arrays to cache lines.
+// Tr : Dizileri önbellek satırlarına hizalayan ayırıcı.
+template <typename T, std::size_t Alignment = 64>
+struct AlignedAllocator
+{
+    typedef T value_type;
+    template <typename U>
+    struct rebind
+    {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+    AlignedAllocator() noexcept {}
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+    T *allocate(std::size_t count)
+    {
+        return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T *pointer, std::size_t) noexcept
+    {
+        ::operator delete(pointer, std::align_val_t(Alignment));
+    }
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept { return false; }
+};
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+// En : Vertex attributes in the order of their streams. The values are also the attribute locations of the shaders.
+// Tr : Akışlarının sırasıyla köşe nitelikleri. Değerler aynı zamanda gölgelendiricilerin nitelik konumlarıdır.
+enum class VertexAttribute
+{
+    Position,
+    Color,
+    Normal,
+    UV,
+    Object,
+    Count
+};
+const unsigned int AllVertexAttributes = (1u << (int)VertexAttribute::Count) - 1;
+
+// En : Read only view of the bytes of an attribute. Stride is the size of one vertex.
+// Tr : Bir niteliğin baytlarının salt okunur görünümü. Stride bir köşenin boyutudur.
+struct StreamView
+{
+    const char *data;
+    int stride, count;
+};
+
+// En : Class declaration for vertex streams. Element i of every enabled attribute belongs to vertex i. Indices are triangle lists into the same vertices.
+// Tr : Köşe akışları için sınıf bildirimi. Etkin her niteliğin i. elemanı i. köşeye aittir. İndisler aynı köşelere üçgen listeleridir.
+// En : Streams can only be moved, so a copy of the geometry can never be made by accident.
+// Tr : Akışlar yalnızca taşınabilir, böylece geometrinin bir kopyası asla kazara yapılamaz.
+class VertexStreams
+{
+private:
+    unsigned int enabled = 0;
+
+public:
+    AlignedVector<glm::vec3> positions, colors, normals;
+    AlignedVector<glm::vec2> uvs;
+    AlignedVector<int> objects;
+    std::vector<int> indices;
+
+    VertexStreams() = default;
+    VertexStreams(VertexStreams &&) = default;
+    VertexStreams &operator=(VertexStreams &&) = default;
+    VertexStreams(const VertexStreams &) = delete;
+    VertexStreams &operator=(const VertexStreams &) = delete;
+
+    void Enable(VertexAttribute attribute);
+    bool Has(VertexAttribute attribute) const;
+    int GetSize() const;
+    // En : Bytes reserved by the arrays, including the unused capacity.
+    // Tr : Kullanılmayan kapasite dahil dizilerin ayırdığı baytlar.
+    long long GetBytes() const;
+    StreamView View(VertexAttribute attribute) const;
+
+    // En : Append the attributes of other selected by mask, and its indices if indices is set, and release them in other. If there are no vertices yet, the arrays of other are taken over without a copy.
+    // Tr : other'ın mask ile seçilen niteliklerini, indices ayarlıysa indislerini de ekle ve other içinde serbest bırak. Henüz köşe yoksa other'ın dizileri kopyalanmadan devralınır.
+    void Append(VertexStreams &other, unsigned int mask = AllVertexAttributes, bool indices = true);
+};
+
+#endif
@@ -0,0 +1,228 @@
+// En : Definitions of Surface.h file.
+// Tr : Surface.h dosyasının tanımlamaları.
+#include "Surface.h"
+#include "Jobs.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const int SurfaceGrainVertices = 4096;
+const float SurfacePi = 3.14159265358979323846f;
+
+// En : Rows per task, so that every task writes a few thousand vertices.
+// Tr : Görev başına satır, böylece her görev birkaç bin köşe yazar.
+int SurfaceGrain(const ParametricSurface &surface)
+{
+    return std::max(1, SurfaceGrainVertices / (surface.columns + 1));
+}
+
+float SurfaceU(const ParametricSurface &surface, int column)
+{
+    return surface.u.x + (surface.u.y - surface.u.x) * column / surface.columns;
+}
+
+float SurfaceV(const ParametricSurface &surface, int row)
+{
+    return surface.v.x + (surface.v.y - surface.v.x) * row / surface.rows;
+}
+
+// En : Unit vector at an angle. Components below the float noise of cos and sin are snapped to zero, so that the poles collapse into one point and their triangles are exactly degenerate instead of tiny and arbitrarily wound.
+// Tr : Bir açıdaki birim vektör. cos ve sin'in float gürültüsünün altındaki bileşenler sıfıra yuvarlanır, böylece kutuplar tek bir noktaya çöker ve üçgenleri küçük ve rastgele sarılmış yerine tam olarak dejenere olur.
+glm::vec2 SurfaceDirection(float angle)
+{
+    glm::vec2 direction = glm::vec2(std::cos(angle), std::sin(angle));
+    for (int i = 0; i < 2; i++)
+        if (std::abs(direction[i]) < 1e-6f)
+            direction[i] = 0.0f;
+    return direction;
+}
+
+// En : Every preset is a surface of revolution around the y axis. The profile gives the distance from the axis and the height at v, and the normal in the same plane.
+// Tr : Her hazır yüzey y ekseni etrafında bir dönel yüzeydir. Profil, v noktasında eksenden uzaklığı ve yüksekliği, aynı düzlemdeki normali verir.
+void SurfaceProfile(const ParametricSurface &surface, float v, glm::vec2 &point, glm::vec2 &normal)
+{
+    float angle;
+    switch (surface.preset)
+    {
+    case SurfacePreset::Torus:
+        angle = 2 * SurfacePi * v;
+        normal = SurfaceDirection(angle);
+        point = glm::vec2(surface.radius, 0.0f) + surface.tube * normal;
+        return;
+    case SurfacePreset::Capsule:
+    {
+        // En : v is spread over the arc length, so the hemispheres and the side get evenly spaced rows.
+        // Tr : v yay uzunluğuna yayılır, böylece yarım küreler ve yan yüz eşit aralıklı satırlar alır.
+        float quarter = SurfacePi * surface.radius / 2, length = v * (2 * quarter + surface.height);
+        float center = -surface.height / 2;
+        if (length < quarter)
+            angle = length / surface.radius - SurfacePi / 2;
+        else if (length < quarter + surface.height)
+        {
+            angle = 0.0f;
+            center += length - quarter;
+        }
+        else
+        {
+            angle = (length - quarter - surface.height) / surface.radius;
+            center = surface.height / 2;
+        }
+        normal = SurfaceDirection(angle);
+        point = glm::vec2(0.0f, center) + surface.radius * normal;
+        return;
+    }
+    default:
+        angle = SurfacePi * (v - 0.5f);
+        normal = SurfaceDirection(angle);
+        point = surface.radius * normal;
+        return;
+    }
+}
+
+// En : Fill either stream of a preset. The angles of the columns are computed once, every row evaluates its profile once, so a vertex costs a few multiplications.
+// Tr : Bir hazır yüzeyin akışlarından birini doldur. Sütunların açıları bir kez hesaplanır, her satır profilini bir kez değerlendirir, böylece bir köşe birkaç çarpmaya mal olur.
+void SurfaceRevolve(const ParametricSurface &surface, glm::vec3 *output, bool normals)
+{
+    int width = surface.columns + 1;
+    std::vector<glm::vec2> angles(width);
+    for (int i = 0; i < width; i++)
+    {
+        float angle = 2 * SurfacePi * SurfaceU(surface, i);
+        angles[i] = glm::vec2(std::cos(angle), -std::sin(angle));
+    }
+    ParallelFor(0, surface.rows + 1, SurfaceGrain(surface), [&](int first, int last)
+                {
+                    for (int j = first; j < last; j++)
+                    {
+                        glm::vec2 point, normal;
+                        SurfaceProfile(surface, SurfaceV(surface, j), point, normal);
+                        glm::vec2 profile = normals ? normal : point;
+                        glm::vec3 *row = output + j * width;
+                        for (int i = 0; i < width; i++)
+                            row[i] = glm::vec3(profile.x * angles[i].x, profile.y, profile.x * angles[i].y);
+                    }
+                });
+}
+
+int SurfaceVertexCount(const ParametricSurface &surface)
+{
+    return (surface.columns + 1) * (surface.rows + 1);
+}
+
+int SurfaceIndexCount(const ParametricSurface &surface)
+{
+    return 6 * surface.columns * surface.rows;
+}
+
+void SurfacePositions(const ParametricSurface &surface, glm::vec3 *output)
+{
+    if (surface.preset != SurfacePreset::None)
+    {
+        SurfaceRevolve(surface, output, false);
+        return;
+    }
+    // En : The parameters are written into the output, the expression then overwrites them block by block.
+    // Tr : Parametreler çıktıya yazılır, ifade ardından bunların üzerine blok blok yazar.
+    int width = surface.columns + 1;
+    ParallelFor(0, surface.rows + 1, SurfaceGrain(surface), [&](int first, int last)
+                {
+                    for (int j = first; j < last; j++)
+                    {
+                        float v = SurfaceV(surface, j);
+                        for (int i = 0; i < width; i++)
+                            output[j * width + i] = glm::vec3(SurfaceU(surface, i), v, 0.0f);
+                    }
+                });
+    surface.expression.Evaluate(output, output, SurfaceVertexCount(surface));
+}
+
+void SurfaceNormals(const ParametricSurface &surface, const glm::vec3 *positions, glm::vec3 *output)
+{
+    if (surface.preset != SurfacePreset::None)
+    {
+        SurfaceRevolve(surface, output, true);
+        return;
+    }
+    int width = surface.columns + 1, height = surface.rows + 1;
+    auto at = [&](int i, int j)
+    { return positions[j * width + i]; };
+    // En : Borders whose first and last vertices meet, like the seam of a revolved surface, are wrapped instead of differenced one sided.
+    // Tr : İlk ve son köşeleri buluşan kenarlar, dönel bir yüzeyin dikişi gibi, tek taraflı fark yerine sarılır.
+    auto closed = [](glm::vec3 a, glm::vec3 b)
+    { return glm::dot(a - b, a - b) <= 1e-10f * (1.0f + glm::dot(a, a)); };
+    auto tangentU = [&](int i, int j)
+    {
+        int left = i - 1, right = i + 1;
+        if (left < 0)
+            left = closed(at(0, j), at(width - 1, j)) ? width - 2 : 0;
+        if (right >= width)
+            right = closed(at(0, j), at(width - 1, j)) ? 1 : width - 1;
+        return at(right, j) - at(left, j);
+    };
+    auto tangentV = [&](int i, int j)
+    {
+        int down = j - 1, up = j + 1;
+        if (down < 0)
+            down = closed(at(i, 0), at(i, height - 1)) ? height - 2 : 0;
+        if (up >= height)
+            up = closed(at(i, 0), at(i, height - 1)) ? 1 : height - 1;
+        return at(i, up) - at(i, down);
+    };
+    ParallelFor(0, height, SurfaceGrain(surface), [&](int first, int last)
+                {
+                    for (int j = first; j < last; j++)
+                        for (int i = 0; i < width; i++)
+                        {
+                            glm::vec3 u = tangentU(i, j), v = tangentV(i, j);
+                            // En : A row collapsed into a point, like a pole, borrows the u tangent of its neighbour row.
+                            // Tr : Bir noktaya çökmüş bir satır, bir kutup gibi, komşu satırın u teğetini ödünç alır.
+                            if (glm::dot(u, u) < 1e-20f && height > 1)
+                                u = tangentU(i, j ? j - 1 : 1);
+                            glm::vec3 normal = glm::cross(u, v);
+                            float length = glm::length(normal);
+                            output[j * width + i] = length > 0.0f ? normal / length : glm::vec3(0, 1, 0);
+                        }
+                });
+}
+
+void SurfaceUVs(const ParametricSurface &surface, glm::vec2 *output)
+{
+    int width = surface.columns + 1;
+    ParallelFor(0, surface.rows + 1, SurfaceGrain(surface), [&](int first, int last)
+                {
+                    for (int j = first; j < last; j++)
+                    {
+                        float v = SurfaceV(surface, j);
+                        for (int i = 0; i < width; i++)
+                            output[j * width + i] = glm::vec2(SurfaceU(surface, i), v);
+                    }
+                });
+}
+
+void SurfaceIndices(const ParametricSurface &surface, int *output)
+{
+    int width = surface.columns + 1;
+    ParallelFor(0, surface.rows, SurfaceGrain(surface), [&](int first, int last)
+                {
+                    for (int j = first; j < last; j++)
+                    {
+                        // En : The first triangle of a quad holds the edge shared with the previous quad of the row.
+                        // Tr : Bir dörtgenin ilk üçgeni, satırın önceki dörtgeniyle paylaşılan kenarı tutar.
+                        int *triangle = output + 6 * j * surface.columns;
+                        bool forward = j % 2 == 0;
+                        for (int k = 0; k < surface.columns; k++, triangle += 6)
+                        {
+                            int a = j * width + (forward ? k : surface.columns - 1 - k), b = a + 1, c = a + width, d = c + 1;
+                            int first = forward ? 0 : 3, second = 3 - first;
+                            triangle[first] = a;
+                            triangle[first + 1] = d;
+                            triangle[first + 2] = c;
+                            triangle[second] = a;
+                            triangle[second + 1] = b;
+                            triangle[second + 2] = d;
+                        }
+                    }
+                });
+}
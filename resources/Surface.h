@@ -0,0 +1,47 @@
+// En : This file contains the structure and function prototypes for parametric surfaces. A surface is sampled on a regular (u, v) grid, every stream of the grid is generated on every core.
+// Tr : Bu dosya, parametrik yüzeyler için yapı ve fonksiyon prototiplerini içerir. Bir yüzey düzenli bir (u, v) ızgarasında örneklenir, ızgaranın her akışı her çekirdekte oluşturulur.
+#include <glm/glm.hpp>
+#include "Expression.h"
+#ifndef SURFACE_H
+#define SURFACE_H
+
+// En : Closed form surfaces. None evaluates the expression of the surface.
+// Tr : Kapalı formdaki yüzeyler. None yüzeyin ifadesini değerlendirir.
+enum class SurfacePreset
+{
+    None,
+    Sphere,
+    Torus,
+    Capsule
+};
+
+// En : Description of a surface. u and v hold the begin and the end of the parameter ranges, presets map [0, 1] to the whole shape. The grid has columns + 1 vertices along u and rows + 1 along v.
+// Tr : Bir yüzeyin tanımı. u ve v parametre aralıklarının başını ve sonunu tutar, hazır yüzeyler [0, 1] aralığını bütün şekle eşler. Izgara u boyunca columns + 1, v boyunca rows + 1 köşeye sahiptir.
+// En : Expression is compiled over the variables "uv" and returns vec(x, y, z). The front side is the side of cross(dP/du, dP/dv), presets face outwards.
+// Tr : Expression "uv" değişkenleri üzerinde derlenir ve vec(x, y, z) döndürür. Ön yüz cross(dP/du, dP/dv) tarafıdır, hazır yüzeyler dışa bakar.
+struct ParametricSurface
+{
+    SurfacePreset preset = SurfacePreset::None;
+    glm::vec2 u = glm::vec2(0.0f, 1.0f), v = glm::vec2(0.0f, 1.0f);
+    int columns = 32, rows = 32;
+    // En : Sphere and capsule radius, torus ring radius. Tube is the torus tube radius, height the length of the capsule between its hemispheres.
+    // Tr : Küre ve kapsül yarıçapı, simit halka yarıçapı. Tube simidin boru yarıçapı, height kapsülün yarım küreleri arasındaki uzunluğudur.
+    float radius = 1.0f, tube = 0.25f, height = 1.0f;
+    ColorExpression expression;
+};
+
+// En : Sizes of the streams of a surface.
+// Tr : Bir yüzeyin akışlarının boyutları.
+int SurfaceVertexCount(const ParametricSurface &surface);
+int SurfaceIndexCount(const ParametricSurface &surface);
+
+// En : Fill the streams of a surface, the arrays must hold the counts above. Presets get closed form positions and normals, expression surfaces get normals from central differences over positions, the output of SurfacePositions. Presets ignore positions.
+// Tr : Bir yüzeyin akışlarını doldur, diziler yukarıdaki sayıları tutmalıdır. Hazır yüzeyler kapalı form pozisyon ve normaller alır, ifade yüzeyleri normallerini SurfacePositions çıktısı olan positions üzerindeki merkezi farklardan alır. Hazır yüzeyler positions'ı yok sayar.
+void SurfacePositions(const ParametricSurface &surface, glm::vec3 *output);
+void SurfaceNormals(const ParametricSurface &surface, const glm::vec3 *positions, glm::vec3 *output);
+void SurfaceUVs(const ParametricSurface &surface, glm::vec2 *output);
+// En : Triangles are emitted row by row, reversing the direction on every other row, so that consecutive triangles share an edge like a strip does and the vertex cache stays warm.
+// Tr : Üçgenler satır satır, her iki satırda bir yön değiştirilerek yayılır, böylece ardışık üçgenler bir şerit gibi bir kenar paylaşır ve köşe önbelleği sıcak kalır.
+void SurfaceIndices(const ParametricSurface &surface, int *output);
+
+#endif
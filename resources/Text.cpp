@@ -3,8 +3,11 @@
 #include "Text.h"
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_MODULE_H
 #include <iostream>
 #include <filesystem>
+#include <algorithm>
+#include <cstring>
 Text::Text(const char *content, const char *font, int size)
 {
     this->content = std::string(content, content + strlen(content));
@@ -14,144 +17,644 @@ Text::Text(const char *content, const char *font, int size)
 Text::~Text()
 {
 }
-void Text::LoadCharacters()
+void DecodeUTF8(const std::string &text, std::vector<unsigned int> &codepoints)
 {
-    // En: Load a font face from a file.
-    // Tr: Bir dosyadan font yüzünü yükle.
-    FT_Face face;
-    if (FT_New_Face(ft, font, 0, &face))
+    static const unsigned int minimum[5] = {0, 0, 0x80, 0x800, 0x10000};
+    codepoints.clear();
+    const unsigned char *bytes = (const unsigned char *)text.data();
+    int count = text.size();
+    for (int i = 0; i < count;)
     {
-        std::cout << "Failed to load font" << std::endl;
-        return;
+        unsigned int c = bytes[i];
+        int length = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2
+                                : (c >> 4) == 0xE   ? 3
+                                : (c >> 3) == 0x1E  ? 4
+                                                    : 0;
+        unsigned int codepoint = length == 1 ? c : c & (0x7F >> length);
+        bool valid = length && i + length <= count;
+        for (int k = 1; valid && k < length; k++)
+        {
+            valid = (bytes[i + k] & 0xC0) == 0x80;
+            codepoint = codepoint << 6 | (bytes[i + k] & 0x3F);
+        }
+        // En: Overlong forms and surrogates are rejected as well.
+        // Tr: Gereğinden uzun biçimler ve vekiller de reddedilir.
+        if (!valid || codepoint < minimum[length] || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+        {
+            codepoints.push_back(0xFFFD);
+            i++;
+            continue;
+        }
+        codepoints.push_back(codepoint);
+        i += length;
     }
-    FT_Set_Pixel_Sizes(face, 0, size);
+}
 
-    // En: Generate character textures.
-    // Tr: Karakter dokularını oluştur.
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    for (unsigned char c = 0; c < 128; c++)
+template <typename T>
+CodepointMap<T>::CodepointMap(int capacity)
+{
+    int size = 16;
+    while (size < capacity)
+        size *= 2;
+    keys.assign(size, Empty);
+    values.resize(size);
+}
+template <typename T>
+unsigned int CodepointMap<T>::Slot(unsigned int key) const
+{
+    unsigned int hash = key * 0x9E3779B1u;
+    return (hash ^ hash >> 15) & (keys.size() - 1);
+}
+template <typename T>
+void CodepointMap<T>::Rehash(int capacity)
+{
+    std::vector<unsigned int> oldKeys(capacity, Empty);
+    std::vector<T> oldValues(capacity);
+    oldKeys.swap(keys);
+    oldValues.swap(values);
+    count = 0;
+    for (int i = 0; i < (int)oldKeys.size(); i++)
+        if (oldKeys[i] != Empty)
+            Insert(oldKeys[i], oldValues[i]);
+}
+template <typename T>
+T *CodepointMap<T>::Find(unsigned int key)
+{
+    for (unsigned int i = Slot(key); keys[i] != Empty; i = (i + 1) & (keys.size() - 1))
+        if (keys[i] == key)
+            return &values[i];
+    return nullptr;
+}
+template <typename T>
+T &CodepointMap<T>::Insert(unsigned int key, const T &value)
+{
+    if ((count + 1) * 4 > (int)keys.size() * 3)
+        Rehash(keys.size() * 2);
+    unsigned int i = Slot(key);
+    for (; keys[i] != Empty && keys[i] != key; i = (i + 1) & (keys.size() - 1))
+        ;
+    if (keys[i] == Empty)
+        count++;
+    keys[i] = key;
+    values[i] = value;
+    return values[i];
+}
+template <typename T>
+void CodepointMap<T>::Erase(unsigned int key)
+{
+    unsigned int mask = keys.size() - 1, i = Slot(key);
+    for (; keys[i] != key; i = (i + 1) & mask)
+        if (keys[i] == Empty)
+            return;
+    // En: Move back every following entry whose home slot is not between the hole and itself.
+    // Tr: Ana yuvası boşluk ile kendisi arasında olmayan her sonraki girdiyi geri taşı.
+    for (unsigned int j = (i + 1) & mask; keys[j] != Empty; j = (j + 1) & mask)
     {
-        if (content.find(c) == std::string::npos)
-            continue;
-
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER))
+        unsigned int home = Slot(keys[j]);
+        if (j > i ? (home <= i || home > j) : (home <= i && home > j))
         {
-            std::cout << "Failed to load Glyph" << std::endl;
-            continue;
+            keys[i] = keys[j];
+            values[i] = values[j];
+            i = j;
         }
+    }
+    keys[i] = Empty;
+    count--;
+}
+template <typename T>
+int CodepointMap<T>::Size() const
+{
+    return count;
+}
+
+GlyphAtlas::GlyphAtlas(const char *font, int pixelSize, bool sdf, int budgetBytes, int pageSize, int rasterBudget)
+    : pixelSize(pixelSize), pageSize(pageSize), sdf(sdf), rasterBudget(rasterBudget)
+{
+    maxPages = std::max(1, budgetBytes / (pageSize * pageSize));
+    cellSize = pageSize;
+    cellsPerPage = 1;
+
+    // En: Load a font face from a file. It is kept open for the glyphs that are rasterised later.
+    // Tr: Bir dosyadan font yüzünü yükle. Daha sonra rasterleştirilecek glifler için açık tutulur.
+    if (FT_New_Face(ft, font, 0, &face))
+    {
+        std::cout << "Failed to load font" << std::endl;
+        face = nullptr;
+        return;
+    }
+    FT_Set_Pixel_Sizes(face, 0, pixelSize);
 
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_RED,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer);
+    // En: The SDF renderer needs FreeType 2.11, older versions fall back to bitmaps. The spread is set once per library.
+    // Tr: SDF oluşturucu FreeType 2.11 gerektirir, eski sürümler bit eşlemlere döner. Yayılım kütüphane başına bir kez atanır.
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+    static bool spreadSet = false;
+    if (sdf && !spreadSet)
+    {
+        FT_Int spread = SDFSpread;
+        FT_Property_Set(ft, "sdf", "spread", &spread);
+        FT_Property_Set(ft, "bsdf", "spread", &spread);
+        spreadSet = true;
+    }
+#else
+    if (sdf)
+    {
+        std::cout << "Error: SDF glyphs need FreeType 2.11 or later" << std::endl;
+        GlobalGlyphMode = GlyphMode::Bitmap;
+        this->sdf = false;
+    }
+#endif
 
+    // En: A cell holds the tallest or widest glyph, the SDF spread and a one pixel border on each side.
+    // Tr: Bir hücre en uzun veya en geniş glifi, SDF yayılımını ve her yanda bir piksellik kenarı tutar.
+    int extent = (int)(std::max(face->size->metrics.height, face->size->metrics.max_advance) >> 6);
+    cellSize = std::min(pageSize, extent + (this->sdf ? 2 * SDFSpread : 0) + 2);
+    cellsPerPage = (pageSize / cellSize) * (pageSize / cellSize);
+}
+GlyphAtlas::~GlyphAtlas()
+{
+    for (GLuint page : pages)
+        GlobalState.DeleteTexture(page);
+    if (face)
+        FT_Done_Face(face);
+}
+int GlyphAtlas::AllocateCell()
+{
+    // En: Step 1 : Take an unused cell, adding a page while the budget allows.
+    // Tr: Adım 1 : Kullanılmayan bir hücre al, bütçe izin verdikçe sayfa ekle.
+    if ((int)cells.size() == (int)pages.size() * cellsPerPage && (int)pages.size() < maxPages)
+    {
+        GLuint page;
+        glGenTextures(1, &page);
+        GlobalState.BindTexture(GL_TEXTURE_2D, page);
+        GlobalState.TexImage2D(GL_TEXTURE_2D, 0, GL_R8, pageSize, pageSize, GL_RED, GL_UNSIGNED_BYTE, nullptr);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        pages.push_back(page);
+    }
+    if ((int)cells.size() < (int)pages.size() * cellsPerPage)
+    {
+        cells.push_back({0, 0, 0, false});
+        return cells.size() - 1;
+    }
 
-        Character character = {
-            texture,
-            glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-            glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
-            static_cast<unsigned int>(face->glyph->advance.x)};
+    // En: Step 2 : Evict the least recently used glyph that is not used in this frame.
+    // Tr: Adım 2 : Bu karede kullanılmayan, en uzun süredir kullanılmayan glifi çıkar.
+    int victim = -1;
+    for (int i = 0; i < (int)cells.size(); i++)
+        if (cells[i].lastUsed != GlobalGlyphFrame && (victim < 0 || cells[i].lastUsed < cells[victim].lastUsed))
+            victim = i;
+    if (victim < 0)
+        return -1;
+    glyphs.Erase(cells[victim].codepoint);
+    cells[victim].generation++;
+    evictions++;
+    return victim;
+}
+bool GlyphAtlas::Rasterize(unsigned int codepoint, Character &character)
+{
+    if (FT_Load_Char(face, codepoint, sdf ? FT_LOAD_DEFAULT : FT_LOAD_RENDER))
+    {
+        std::cout << "Failed to load Glyph" << std::endl;
+        return false;
+    }
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+    if (sdf && FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF))
+    {
+        std::cout << "Failed to render SDF Glyph" << std::endl;
+        return false;
+    }
+#endif
+    const FT_Bitmap &bitmap = face->glyph->bitmap;
+    character = {
+        0,
+        glm::ivec2(bitmap.width, bitmap.rows),
+        glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
+        static_cast<unsigned int>(face->glyph->advance.x),
+        glm::vec2(0.0f),
+        glm::vec2(0.0f),
+        -1};
+    if (!bitmap.width || !bitmap.rows)
+        return true;
 
-        characters.insert(std::pair<char, Character>(c, character));
+    int cell = AllocateCell();
+    if (cell < 0)
+    {
+        if (!fullReported)
+            std::cout << "Error: glyph atlas is full, glyphs are dropped until some are unused" << std::endl;
+        fullReported = true;
+        return false;
     }
-    FT_Done_Face(face);
+
+    // En: The whole cell is written, so that filtering never reads the glyph that was evicted from it.
+    // Tr: Hücrenin tamamı yazılır, böylece filtreleme ondan çıkarılan glifi asla okumaz.
+    int width = std::min((int)bitmap.width, cellSize - 2), rows = std::min((int)bitmap.rows, cellSize - 2);
+    scratch.assign(cellSize * cellSize, 0);
+    for (int y = 0; y < rows; y++)
+        std::memcpy(&scratch[(y + 1) * cellSize + 1], bitmap.buffer + y * bitmap.pitch, width);
+    int page = cell / cellsPerPage, index = cell % cellsPerPage, perRow = pageSize / cellSize;
+    int x = index % perRow * cellSize, y = index / perRow * cellSize;
+    GlobalState.BindTexture(GL_TEXTURE_2D, pages[page]);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, cellSize, cellSize, GL_RED, GL_UNSIGNED_BYTE, scratch.data());
+    GlobalState.CountUpload(cellSize * cellSize);
+
+    character.textureID = pages[page];
+    character.size = glm::ivec2(width, rows);
+    character.uvMin = glm::vec2(x + 1, y + 1) / (float)pageSize;
+    character.uvMax = glm::vec2(x + 1 + width, y + 1 + rows) / (float)pageSize;
+    character.cell = cell;
+    cells[cell] = {codepoint, GlobalGlyphFrame, cells[cell].generation, true};
+    return true;
+}
+const Character *GlyphAtlas::Get(unsigned int codepoint, bool &pending)
+{
+    if (Character *character = glyphs.Find(codepoint))
+    {
+        if (character->cell >= 0)
+            cells[character->cell].lastUsed = GlobalGlyphFrame;
+        return character;
+    }
+    if (!face)
+        return nullptr;
+    if (rasterFrame != GlobalGlyphFrame)
+    {
+        rasterFrame = GlobalGlyphFrame;
+        rasterized = 0;
+    }
+    Character character;
+    if (rasterized >= rasterBudget || !Rasterize(codepoint, character))
+    {
+        pending = true;
+        return nullptr;
+    }
+    rasterized++;
+    return &glyphs.Insert(codepoint, character);
+}
+void GlyphAtlas::Touch(int cell)
+{
+    cells[cell].lastUsed = GlobalGlyphFrame;
+}
+unsigned int GlyphAtlas::GetGeneration(int cell) const
+{
+    return cells[cell].generation;
+}
+unsigned int GlyphAtlas::GetEvictions() const
+{
+    return evictions;
+}
+long long GlyphAtlas::GetMemory() const
+{
+    return (long long)pages.size() * pageSize * pageSize;
+}
+GlyphAtlas *GetGlyphAtlas(const char *font, int pixelSize)
+{
+    if (!font)
+        return nullptr;
+    GlyphAtlas *&atlas = GlobalAtlases[{font, pixelSize}];
+    if (!atlas)
+        atlas = new GlyphAtlas(font, pixelSize, GlobalGlyphMode == GlyphMode::SDF);
+    return atlas;
+}
+
+void Text::Layout()
+{
+    // En: Step 1 : Find the shared atlas. SDF glyphs are shared by every size and scaled here.
+    // Tr: Adım 1 : Paylaşılan atlası bul. SDF glifleri tüm boyutlar tarafından paylaşılır ve burada ölçeklenir.
+    int pixelSize = GlobalGlyphMode == GlyphMode::SDF ? SDFReferenceSize : size;
+    float scale = (float)size / pixelSize;
+    atlas = GetGlyphAtlas(font ? font : GlobalFont, pixelSize);
+    std::vector<unsigned int> codepoints;
+    DecodeUTF8(content, codepoints);
+
+    // En: Step 2 : Place a quad for every visible glyph and advance the pen. Glyphs that are not rasterised yet are laid out in a later frame.
+    // Tr: Adım 2 : Her görünür glif için bir dörtgen yerleştir ve kalemi ilerlet. Henüz rasterleştirilmemiş glifler sonraki bir karede yerleştirilir.
+    std::vector<std::pair<GLuint, int>> order;
+    std::vector<float> quads;
+    bool pending = false;
+    cells.clear();
+    float pen = position.x;
+    for (unsigned int codepoint : codepoints)
+    {
+        const Character *found = atlas ? atlas->Get(codepoint, pending) : nullptr;
+        if (!found)
+            continue;
+        Character ch = *found;
+        if (ch.cell >= 0)
+        {
+            float x = pen + ch.bearing.x * scale,
+                  y = position.y - (ch.size.y - ch.bearing.y) * scale,
+                  w = ch.size.x * scale,
+                  h = ch.size.y * scale;
+            float quad[TextQuadFloats] = {
+                x, y + h, ch.uvMin.x, ch.uvMin.y, color.x, color.y, color.z,
+                x, y, ch.uvMin.x, ch.uvMax.y, color.x, color.y, color.z,
+                x + w, y, ch.uvMax.x, ch.uvMax.y, color.x, color.y, color.z,
+                x, y + h, ch.uvMin.x, ch.uvMin.y, color.x, color.y, color.z,
+                x + w, y, ch.uvMax.x, ch.uvMax.y, color.x, color.y, color.z,
+                x + w, y + h, ch.uvMax.x, ch.uvMin.y, color.x, color.y, color.z};
+            order.push_back({ch.textureID, (int)order.size()});
+            quads.insert(quads.end(), quad, quad + TextQuadFloats);
+            cells.push_back({ch.cell, atlas->GetGeneration(ch.cell)});
+        }
+        pen += (ch.advance >> 6) * scale;
+    }
+    seenEvictions = atlas ? atlas->GetEvictions() : 0;
+
+    // En: Step 3 : Group the quads by atlas page, so that every page is drawn once.
+    // Tr: Adım 3 : Dörtgenleri atlas sayfasına göre grupla, böylece her sayfa bir kez çizilir.
+    std::stable_sort(order.begin(), order.end(), [](const std::pair<GLuint, int> &a, const std::pair<GLuint, int> &b)
+                     { return a.first < b.first; });
+    vertices.resize(quads.size());
+    textures.resize(order.size());
+    runs.clear();
+    for (int i = 0; i < (int)order.size(); i++)
+    {
+        std::copy_n(quads.begin() + order[i].second * TextQuadFloats, TextQuadFloats, vertices.begin() + i * TextQuadFloats);
+        textures[i] = order[i].first;
+        if (runs.empty() || runs.back().texture != order[i].first)
+            runs.push_back({order[i].first, i, 0});
+        runs.back().count++;
+    }
+    // En: Held back glyphs are laid out again in the next frame, which has to be asked for when frames are drawn on demand.
+    // Tr: Bekletilen glifler sonraki karede yeniden yerleştirilir, kareler istek üzerine çizildiğinde bu kare istenmelidir.
+    dirty = pending;
+    if (pending)
+        GlobalFrames.RequestRedraw();
+    version++;
+    memory.Set((long long)(vertices.capacity() * sizeof(float) + textures.capacity() * sizeof(GLuint) + runs.capacity() * sizeof(GlyphRun) + cells.capacity() * sizeof(std::pair<int, unsigned int>) + content.capacity()));
+}
+void Text::CheckResidency()
+{
+    if (!atlas || atlas->GetEvictions() == seenEvictions)
+        return;
+    seenEvictions = atlas->GetEvictions();
+    for (const std::pair<int, unsigned int> &cell : cells)
+        if (atlas->GetGeneration(cell.first) != cell.second)
+        {
+            dirty = true;
+            return;
+        }
+}
+void Text::Touch()
+{
+    for (const std::pair<int, unsigned int> &cell : cells)
+        atlas->Touch(cell.first);
+}
+void Text::SetContent(const char *content)
+{
+    if (this->content == content)
+        return;
+    this->content = content;
+    dirty = true;
+    GlobalFrames.RequestRedraw();
 }
 void Text::SetColor(glm::vec3 color) noexcept
 {
+    if (this->color == color)
+        return;
     this->color = color;
+    dirty = true;
+    GlobalFrames.RequestRedraw();
 }
 void Text::SetFont(const char *font) noexcept
 {
+    if (this->font == font)
+        return;
     this->font = font;
+    dirty = true;
+    GlobalFrames.RequestRedraw();
 }
 void Text::SetSize(int size) noexcept
 {
+    if (this->size == size)
+        return;
     this->size = size;
+    dirty = true;
+    GlobalFrames.RequestRedraw();
 }
 void Text::SetPosition(glm::vec2 position) noexcept
 {
+    if (this->position == position)
+        return;
     this->position = position;
+    dirty = true;
+    GlobalFrames.RequestRedraw();
+}
+void Text::Update()
+{
+    CheckResidency();
+    if (dirty)
+        Layout();
 }
 unsigned int Text::GetQuadCount() const
 {
-    return content.size();
+    return textures.size();
 }
-float *Text::GetVertices(int &size)
+unsigned int Text::GetVersion() const
 {
-    if (!characters.size())
-        LoadCharacters();
-
-    float *vertices = new float[24 * content.size()];
+    return version;
+}
+const float *Text::GetVertices(int &size) const
+{
+    size = vertices.size();
+    return vertices.data();
+}
+const GLuint *Text::GetTextures(int &size) const
+{
+    size = textures.size();
+    return textures.data();
+}
+const std::vector<GlyphRun> &Text::GetRuns() const
+{
+    return runs;
+}
 
-    float xpos = 0;
-    int index = 0;
-    for (std::string::const_iterator c = content.begin(); c != content.end(); c++)
+TextBuffer::TextBuffer(int capacity) : capacity(capacity), persistent(GLEW_ARB_buffer_storage)
+{
+    glGenVertexArrays(1, &vertexArray);
+    glGenBuffers(1, &vertexBuffer);
+    GlobalState.BindVertexArray(vertexArray);
+    GlobalState.BindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    CreateStorage(GL_ARRAY_BUFFER, capacity);
+    SetLayout();
+}
+TextBuffer::~TextBuffer()
+{
+    for (std::pair<GLsync, std::vector<std::pair<int, int>>> &batch : retired)
+        glDeleteSync(batch.first);
+    GlobalState.DeleteBuffer(vertexBuffer);
+    GlobalState.DeleteVertexArray(vertexArray);
+}
+void TextBuffer::Add(Text *text)
+{
+    slots.push_back({text, 0, 0, 0, 0, {}});
+}
+void TextBuffer::Remove(Text *text)
+{
+    std::vector<Slot>::iterator it = std::find_if(slots.begin(), slots.end(), [text](const Slot &slot)
+                                                  { return slot.text == text; });
+    if (it == slots.end())
+        return;
+    if (it->capacity)
+        Release(it->offset, it->capacity);
+    slots.erase(it);
+}
+void TextBuffer::CreateStorage(GLenum target, int size)
+{
+    if (!persistent)
     {
-        Character ch = characters[*c];
-
-        float x = (position.x + ch.bearing.x) / (2 << 6),
-              y = (position.y - (ch.size.y - ch.bearing.y)) / (2 << 6),
-              w = ch.size.x / (2 << 6),
-              h = ch.size.y / (2 << 6);
-
-        vertices[index] = x;
-        vertices[index + 1] = y + h;
-        vertices[index + 2] = 0.0f;
-        vertices[index + 3] = 0.0f;
-
-        vertices[index + 4] = x;
-        vertices[index + 5] = y;
-        vertices[index + 6] = 0.0f;
-        vertices[index + 7] = 1.0f;
-
-        vertices[index + 8] = x + w;
-        vertices[index + 9] = y;
-        vertices[index + 10] = 1.0f;
-        vertices[index + 11] = 1.0f;
-
-        vertices[index + 12] = x;
-        vertices[index + 13] = y + h;
-        vertices[index + 14] = 0.0f;
-        vertices[index + 15] = 0.0f;
-
-        vertices[index + 16] = x + w;
-        vertices[index + 17] = y;
-        vertices[index + 18] = 1.0f;
-        vertices[index + 19] = 1.0f;
-
-        vertices[index + 20] = x + w;
-        vertices[index + 21] = y + h;
-        vertices[index + 22] = 1.0f;
-        vertices[index + 23] = 1.0f;
+        GlobalState.BufferData(target, size * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+        return;
+    }
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    GlobalState.BufferStorage(target, size * sizeof(float), nullptr, flags);
+    mapping = (float *)glMapBufferRange(target, 0, size * sizeof(float), flags);
+}
+void TextBuffer::Release(int offset, int size)
+{
+    if (persistent)
+        retiring.push_back({offset, size});
+    else
+        freeSlots.push_back({offset, size});
+}
+void TextBuffer::Recycle()
+{
+    // En: A fence is placed once per frame behind the slots released since the last one, so it passes when every frame that drew them is finished.
+    // Tr: Son çitten beri bırakılan yuvaların arkasına karede bir kez bir çit konur, böylece onları çizen her kare bittiğinde geçilir.
+    while (!retired.empty())
+    {
+        GLenum status = glClientWaitSync(retired.front().first, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            break;
+        glDeleteSync(retired.front().first);
+        freeSlots.insert(freeSlots.end(), retired.front().second.begin(), retired.front().second.end());
+        retired.pop_front();
+    }
+    if (!retiring.empty())
+    {
+        retired.push_back({glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), std::move(retiring)});
+        retiring.clear();
+    }
+}
+void TextBuffer::Grow(int size)
+{
+    // En: The old content is copied on the GPU, the texts keep their offsets.
+    // Tr: Eski içerik GPU üzerinde kopyalanır, metinler konumlarını korur.
+    int newCapacity = std::max(capacity * 2, head + size);
+    GLuint newBuffer;
+    glGenBuffers(1, &newBuffer);
+    GlobalState.BindBuffer(GL_COPY_WRITE_BUFFER, newBuffer);
+    CreateStorage(GL_COPY_WRITE_BUFFER, newCapacity);
+    GlobalState.BindBuffer(GL_COPY_READ_BUFFER, vertexBuffer);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, head * sizeof(float));
+    GlobalState.DeleteBuffer(vertexBuffer);
+    vertexBuffer = newBuffer;
+    capacity = newCapacity;
 
-        index += 24;
-        xpos += ch.advance >> 6;
+    // En: The copy writes every free slot of the new mapping too, so they all wait for a fence behind it.
+    // Tr: Kopya yeni eşlemenin her boş yuvasına da yazar, bu yüzden hepsi onun arkasındaki bir çiti bekler.
+    if (persistent)
+    {
+        for (std::pair<GLsync, std::vector<std::pair<int, int>>> &batch : retired)
+        {
+            glDeleteSync(batch.first);
+            freeSlots.insert(freeSlots.end(), batch.second.begin(), batch.second.end());
+        }
+        retired.clear();
+        if (!freeSlots.empty())
+            retired.push_back({glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), std::move(freeSlots)});
+        freeSlots.clear();
     }
 
-    size = content.size() * 24;
+    SetLayout();
+}
+void TextBuffer::SetLayout()
+{
+    GlobalState.BindVertexArray(vertexArray);
+    GlobalState.BindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, TextVertexFloats * sizeof(float), (void *)0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, TextVertexFloats * sizeof(float), (void *)(4 * sizeof(float)));
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+}
+int TextBuffer::Allocate(int size)
+{
+    // En: Reuse the first free slot that fits, otherwise take from the head.
+    // Tr: Sığan ilk boş yuvayı yeniden kullan, aksi halde baştan al.
+    for (std::vector<std::pair<int, int>>::iterator it = freeSlots.begin(); it != freeSlots.end(); ++it)
+        if (it->second >= size)
+        {
+            int offset = it->first;
+            if (it->second == size)
+                freeSlots.erase(it);
+            else
+                *it = {it->first + size, it->second - size};
+            return offset;
+        }
+    if (head + size > capacity)
+        Grow(size);
+    int offset = head;
+    head += size;
+    return offset;
+}
+int TextBuffer::Update()
+{
+    // En: Mark every glyph in the buffer used first, so that laying out a changed text never evicts a glyph of another one.
+    // Tr: Önce tampondaki her glifi kullanıldı olarak işaretle, böylece değişen bir metni yerleştirmek başka bir metnin glifini asla çıkarmaz.
+    GlobalGlyphFrame++;
+    for (Slot &slot : slots)
+        slot.text->Touch();
+    if (persistent)
+        Recycle();
 
-    return vertices;
+    int uploaded = 0;
+    for (Slot &slot : slots)
+    {
+        slot.text->Update();
+        unsigned int version = slot.text->GetVersion();
+        if (version == slot.version)
+            continue;
+        int size;
+        const float *vertices = slot.text->GetVertices(size);
+        if (size > slot.capacity || (persistent && slot.capacity))
+        {
+            if (slot.capacity)
+                Release(slot.offset, slot.capacity);
+            // En: Leave some room, so that a growing counter does not move every frame. Slots stay quad aligned.
+            // Tr: Biraz yer bırak, böylece büyüyen bir sayaç her karede taşınmaz. Yuvalar dörtgen hizalı kalır.
+            slot.capacity = (size + size / 4 + TextQuadFloats - 1) / TextQuadFloats * TextQuadFloats;
+            slot.offset = slot.capacity ? Allocate(slot.capacity) : 0;
+        }
+        slot.size = size;
+        slot.version = version;
+        slot.runs = slot.text->GetRuns();
+        if (!size)
+            continue;
+        if (persistent)
+        {
+            std::memcpy(mapping + slot.offset, vertices, size * sizeof(float));
+            GlobalState.CountUpload(size * sizeof(float));
+        }
+        else
+        {
+            GlobalState.BindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+            GlobalState.BufferSubData(GL_ARRAY_BUFFER, slot.offset * sizeof(float), size * sizeof(float), vertices);
+        }
+        uploaded += size * sizeof(float);
+    }
+    return uploaded;
 }
-GLuint *Text::GetTextures(int &size)
+void TextBuffer::Submit(RenderQueue &queue, GLuint program) const
 {
-    size = content.size();
-    GLuint *textures = new GLuint[size];
-    for (int i = 0; i < size; i++)
+    // En: Offsets are in floats, a vertex has TextVertexFloats of them.
+    // Tr: Konumlar float cinsindendir, bir köşe TextVertexFloats tanesine sahiptir.
+    for (const Slot &slot : slots)
     {
-        textures[i] = characters[content[i]].textureID;
+        if (!slot.size)
+            continue;
+        for (const GlyphRun &run : slot.runs)
+            queue.Submit(RenderPass::Overlay, program, vertexArray, run.texture, GL_TRIANGLES, slot.offset / TextVertexFloats + run.first * 6, run.count * 6, false);
     }
-    return textures;
 }
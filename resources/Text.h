@@ -1,12 +1,20 @@
 #include <string>
 #include <glm/glm.hpp>
 #include <map>
+#include <vector>
+#include <deque>
 #include "Shader.h"
+#include "Queue.h"
+#include "Frames.h"
+#include "Memory.h"
 #ifndef TEXT_H
 #define TEXT_H
 
 const char *GlobalFont = nullptr;
 FT_Library ft;
+
+// En: A glyph placed in an atlas page. Glyphs without pixels (e.g. space) have no cell.
+// Tr: Bir atlas sayfasına yerleştirilmiş glif. Pikseli olmayan gliflerin (örn. boşluk) hücresi yoktur.
 struct Character
 {
 public:
@@ -14,6 +22,107 @@ public:
     glm::ivec2 size;
     glm::ivec2 bearing;
     GLuint advance;
+    glm::vec2 uvMin, uvMax;
+    int cell;
+};
+
+// En: Glyph rasterisation mode. SDF glyphs are generated once at the reference size and edges are rebuilt by the shader at any scale.
+// Tr: Glif rasterleştirme modu. SDF glifleri referans boyutta bir kez oluşturulur ve kenarlar gölgelendirici tarafından her ölçekte yeniden kurulur.
+enum class GlyphMode
+{
+    Bitmap,
+    SDF
+};
+GlyphMode GlobalGlyphMode = GlyphMode::Bitmap;
+const int SDFReferenceSize = 48;
+const int SDFSpread = 8;
+
+// En: Increased once per frame by the text buffers. Glyphs used in the current frame are never evicted.
+// Tr: Metin tamponları tarafından her karede bir kez artırılır. Geçerli karede kullanılan glifler asla çıkarılmaz.
+unsigned int GlobalGlyphFrame = 1;
+
+// En: Decode UTF-8 into codepoints. Malformed sequences become U+FFFD.
+// Tr: UTF-8'i kod noktalarına çöz. Hatalı diziler U+FFFD olur.
+void DecodeUTF8(const std::string &text, std::vector<unsigned int> &codepoints);
+
+// En: Open addressing hash map keyed by codepoint. Linear probing keeps the entries in flat arrays, erasing shifts the following entries back.
+// Tr: Kod noktasıyla anahtarlanan açık adresli hash tablosu. Doğrusal yoklama girdileri düz dizilerde tutar, silme sonraki girdileri geri kaydırır.
+template <typename T>
+class CodepointMap
+{
+private:
+    static constexpr unsigned int Empty = 0xFFFFFFFF;
+    std::vector<unsigned int> keys;
+    std::vector<T> values;
+    int count = 0;
+    unsigned int Slot(unsigned int key) const;
+    void Rehash(int capacity);
+
+public:
+    CodepointMap(int capacity = 256);
+    T *Find(unsigned int key);
+    T &Insert(unsigned int key, const T &value);
+    void Erase(unsigned int key);
+    int Size() const;
+};
+
+// En: Glyph cache of a font at one pixel size. Glyphs are rasterised on first use into fixed size cells of atlas pages.
+// Tr: Bir fontun tek piksel boyutundaki glif önbelleği. Glifler ilk kullanımda atlas sayfalarının sabit boyutlu hücrelerine rasterleştirilir.
+// En: The pages never exceed the memory budget. When every cell is taken, the least recently used glyph is evicted.
+// Tr: Sayfalar asla bellek bütçesini aşmaz. Tüm hücreler dolduğunda en uzun süredir kullanılmayan glif çıkarılır.
+class GlyphAtlas
+{
+private:
+    struct Cell
+    {
+        unsigned int codepoint;
+        unsigned int lastUsed;
+        unsigned int generation;
+        bool used;
+    };
+    FT_Face face = nullptr;
+    int pixelSize, pageSize, maxPages, cellSize, cellsPerPage;
+    bool sdf;
+    std::vector<GLuint> pages;
+    std::vector<Cell> cells;
+    std::vector<unsigned char> scratch;
+    CodepointMap<Character> glyphs;
+    unsigned int evictions = 0, rasterFrame = 0;
+    int rasterized = 0, rasterBudget;
+    bool fullReported = false;
+    int AllocateCell();
+    bool Rasterize(unsigned int codepoint, Character &character);
+
+public:
+    // En: Rasterising is limited to rasterBudget glyphs per frame, so a burst of new glyphs is spread over frames.
+    // Tr: Rasterleştirme karede rasterBudget glif ile sınırlıdır, böylece bir anda gelen yeni glifler karelere yayılır.
+    GlyphAtlas(const char *font, int pixelSize, bool sdf, int budgetBytes = 4 << 20, int pageSize = 1024, int rasterBudget = 64);
+    ~GlyphAtlas();
+    // En: Get a glyph and mark it used. Returns nullptr and sets pending if it has to wait for a later frame.
+    // Tr: Bir glif al ve kullanıldı olarak işaretle. Sonraki bir kareyi beklemesi gerekiyorsa nullptr döndürür ve pending atar.
+    const Character *Get(unsigned int codepoint, bool &pending);
+    void Touch(int cell);
+    unsigned int GetGeneration(int cell) const;
+    unsigned int GetEvictions() const;
+    long long GetMemory() const;
+};
+
+// En: Atlases are shared by every text with the same font and pixel size.
+// Tr: Atlaslar aynı font ve piksel boyutundaki tüm metinler tarafından paylaşılır.
+std::map<std::pair<std::string, int>, GlyphAtlas *> GlobalAtlases;
+GlyphAtlas *GetGlyphAtlas(const char *font, int pixelSize);
+
+// En: Floats of one text vertex: position and texture coordinates, then the color of the text.
+// Tr: Bir metin köşesinin float sayısı: pozisyon ve doku koordinatları, ardından metnin rengi.
+const int TextVertexFloats = 7;
+const int TextQuadFloats = 6 * TextVertexFloats;
+
+// En: Consecutive quads of a laid out text that use the same atlas page.
+// Tr: Yerleştirilmiş bir metnin aynı atlas sayfasını kullanan ardışık dörtgenleri.
+struct GlyphRun
+{
+    GLuint texture;
+    int first, count;
 };
 
 class Text
@@ -22,22 +131,96 @@ private:
     std::string content;
     const char *font;
     glm::vec3 color = glm::vec3(1.0f);
-    glm::vec2 position;
+    glm::vec2 position = glm::vec2(0.0f);
     int size;
-    std::map<char, Character> characters;
-    void LoadCharacters();
+    GlyphAtlas *atlas = nullptr;
+    // En: The laid out glyph run. It is rebuilt only when content, color, font, size or position change, or one of its glyphs was evicted.
+    // Tr: Yerleştirilmiş glif dizisi. Yalnızca içerik, renk, font, boyut veya pozisyon değiştiğinde ya da gliflerinden biri çıkarıldığında yeniden oluşturulur.
+    std::vector<float> vertices;
+    std::vector<GLuint> textures;
+    std::vector<GlyphRun> runs;
+    std::vector<std::pair<int, unsigned int>> cells;
+    unsigned int seenEvictions = 0;
+    bool dirty = true;
+    unsigned int version = 0;
+    // En: The laid out arrays are accounted as text, the atlas pages by the state cache.
+    // Tr: Yerleştirilmiş diziler metin olarak hesaplanır, atlas sayfaları durum önbelleği tarafından.
+    MemoryAccount memory{MemoryCategory::Text};
+    void Layout();
+    void CheckResidency();
 
 public:
+    // En: Content is UTF-8.
+    // Tr: İçerik UTF-8'dir.
     Text(const char *content, const char *font = nullptr, int size = 16);
     ~Text();
+    void SetContent(const char *content);
     void SetColor(glm::vec3 color) noexcept;
     void SetFont(const char *font) noexcept;
     void SetSize(int size) noexcept;
     void SetPosition(glm::vec2 position) noexcept;
-    void GenerateQuad();
+    // En: Lay out the text if it changed or lost a glyph. Called once per frame by the buffer holding the text, the getters return the result of the last call.
+    // Tr: Metin değiştiyse veya bir glifini kaybettiyse yerleştir. Metni tutan tampon tarafından karede bir kez çağrılır, erişiciler son çağrının sonucunu döndürür.
+    void Update();
     unsigned int GetQuadCount() const;
-    float *GetVertices(int &size);
-    GLuint *GetTextures(int &size);
+    // En: Increased on every layout, so that buffers can tell which runs changed.
+    // Tr: Her yerleştirmede artırılır, böylece tamponlar hangi dizilerin değiştiğini anlayabilir.
+    unsigned int GetVersion() const;
+    // En: Mark the glyphs of the text used in the current frame.
+    // Tr: Metnin gliflerini geçerli karede kullanıldı olarak işaretle.
+    void Touch();
+    // En: The returned arrays are owned by the text.
+    // Tr: Döndürülen diziler metne aittir.
+    const float *GetVertices(int &size) const;
+    const GLuint *GetTextures(int &size) const;
+    const std::vector<GlyphRun> &GetRuns() const;
+};
+
+// En: Vertex buffer shared by the texts. Every text keeps a slot, and a frame uploads only the runs whose version changed.
+// Tr: Metinler tarafından paylaşılan köşe tamponu. Her metin bir yuva tutar ve bir kare yalnızca sürümü değişen dizileri yükler.
+// En: With ARB_buffer_storage the buffer is persistently mapped like the mesh buffers. Earlier frames may still read a slot, so a changed text moves to a new slot and the old one is reused once a fence passes.
+// Tr: ARB_buffer_storage ile tampon, mesh tamponları gibi kalıcı olarak eşlenir. Önceki kareler bir yuvayı hâlâ okuyor olabilir, bu yüzden değişen bir metin yeni bir yuvaya taşınır ve eskisi bir çit geçildiğinde yeniden kullanılır.
+class TextBuffer
+{
+private:
+    // En: The runs are copied from the text when its vertices are uploaded, so the draws always match the buffer.
+    // Tr: Diziler, köşeleri yüklendiğinde metinden kopyalanır, böylece çizimler her zaman tamponla eşleşir.
+    struct Slot
+    {
+        Text *text;
+        unsigned int version;
+        int offset, capacity, size;
+        std::vector<GlyphRun> runs;
+    };
+    GLuint vertexArray = 0, vertexBuffer = 0;
+    int capacity, head = 0;
+    bool persistent;
+    float *mapping = nullptr;
+    std::vector<Slot> slots;
+    std::vector<std::pair<int, int>> freeSlots, retiring;
+    std::deque<std::pair<GLsync, std::vector<std::pair<int, int>>>> retired;
+    int Allocate(int size);
+    void Grow(int size);
+    void CreateStorage(GLenum target, int size);
+    void SetLayout();
+    void Release(int offset, int size);
+    void Recycle();
+
+public:
+    // En: Capacity is in floats, the buffer doubles when it is full.
+    // Tr: Kapasite float cinsindendir, tampon dolduğunda iki katına çıkar.
+    TextBuffer(int capacity = 1 << 16);
+    ~TextBuffer();
+    // En: A text must be removed before it is deleted.
+    // Tr: Bir metin silinmeden önce çıkarılmalıdır.
+    void Add(Text *text);
+    void Remove(Text *text);
+    // En: Lay out and upload the changed texts. Returns the uploaded byte count.
+    // Tr: Değişen metinleri yerleştir ve yükle. Yüklenen bayt sayısını döndürür.
+    int Update();
+    // En: Submit one packet per glyph run to the overlay pass.
+    // Tr: Kaplama geçişine glif dizisi başına bir paket gönder.
+    void Submit(RenderQueue &queue, GLuint program) const;
 };
 
-#endif
\ No newline at end of file
+#endif
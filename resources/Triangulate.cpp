@@ -0,0 +1,638 @@
+// En : Definitions of Triangulate.h file.
+// Tr : Triangulate.h dosyasının tanımlamaları.
+#include "Triangulate.h"
+#include <deque>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#ifdef BENCHMARK
+#include <chrono>
+#include <iostream>
+#endif
+
+// En : Variables only will be used in this file.
+// Tr : Bu dosyada sadece kullanılacak olan değişkenler.
+const int TriangulationHashThreshold = 80;
+
+// En : A point of a ring. Rings are circular doubly linked lists, the z-order links chain the same points sorted by their curve index.
+// Tr : Bir halkanın noktası. Halkalar dairesel çift bağlı listelerdir, z-sıralı bağlantılar aynı noktaları eğri indislerine göre sıralı zincirler.
+struct TriangulationNode
+{
+    int index;
+    double x, y;
+    TriangulationNode *prev = nullptr, *next = nullptr;
+    uint32_t z = 0;
+    TriangulationNode *prevZ = nullptr, *nextZ = nullptr;
+    bool steiner = false;
+};
+
+// En : Ear clipping state of one polygon. The nodes live in a deque, so that splitting rings does not move the existing ones.
+// Tr : Bir çokgenin kulak kırpma durumu. Düğümler bir deque içinde durur, böylece halkaları bölmek var olanları taşımaz.
+class Triangulator
+{
+private:
+    std::deque<TriangulationNode> nodes;
+    std::vector<int> &triangles;
+    double minX = 0, minY = 0, inverseSize = 0;
+    int gridSize = 0;
+    double gridX = 0, gridY = 0, gridScale = 0;
+    std::vector<std::vector<TriangulationNode *>> gridEdges, gridPoints;
+
+    TriangulationNode *InsertNode(int index, glm::vec2 point, TriangulationNode *last)
+    {
+        nodes.push_back(TriangulationNode());
+        TriangulationNode *p = &nodes.back();
+        p->index = index;
+        p->x = point.x;
+        p->y = point.y;
+        if (!last)
+            p->prev = p->next = p;
+        else
+        {
+            p->next = last->next;
+            p->prev = last;
+            last->next->prev = p;
+            last->next = p;
+        }
+        return p;
+    }
+
+    static void RemoveNode(TriangulationNode *p)
+    {
+        p->next->prev = p->prev;
+        p->prev->next = p->next;
+        if (p->prevZ)
+            p->prevZ->nextZ = p->nextZ;
+        if (p->nextZ)
+            p->nextZ->prevZ = p->prevZ;
+    }
+
+    // En : Twice the signed area of a triangle, negative for counter clockwise corners, which are the convex ones.
+    // Tr : Bir üçgenin işaretli alanının iki katı, dışbükey olan saat yönü tersindeki köşeler için negatif.
+    static double Area(const TriangulationNode *p, const TriangulationNode *q, const TriangulationNode *r)
+    {
+        return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);
+    }
+
+    static bool Equals(const TriangulationNode *a, const TriangulationNode *b)
+    {
+        return a->x == b->x && a->y == b->y;
+    }
+
+    static bool PointInTriangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py)
+    {
+        return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+               (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+               (bx - px) * (cy - py) >= (cx - px) * (by - py);
+    }
+
+    static int Sign(double value)
+    {
+        return (value > 0) - (value < 0);
+    }
+
+    static bool OnSegment(const TriangulationNode *p, const TriangulationNode *q, const TriangulationNode *r)
+    {
+        return q->x <= std::max(p->x, r->x) && q->x >= std::min(p->x, r->x) && q->y <= std::max(p->y, r->y) && q->y >= std::min(p->y, r->y);
+    }
+
+    static bool Intersects(const TriangulationNode *p1, const TriangulationNode *q1, const TriangulationNode *p2, const TriangulationNode *q2)
+    {
+        int o1 = Sign(Area(p1, q1, p2)), o2 = Sign(Area(p1, q1, q2)), o3 = Sign(Area(p2, q2, p1)), o4 = Sign(Area(p2, q2, q1));
+        if (o1 != o2 && o3 != o4)
+            return true;
+        return (o1 == 0 && OnSegment(p1, p2, q1)) || (o2 == 0 && OnSegment(p1, q2, q1)) ||
+               (o3 == 0 && OnSegment(p2, p1, q2)) || (o4 == 0 && OnSegment(p2, q1, q2));
+    }
+
+    static bool IntersectsPolygon(const TriangulationNode *a, const TriangulationNode *b)
+    {
+        const TriangulationNode *p = a;
+        do
+        {
+            if (p->index != a->index && p->next->index != a->index && p->index != b->index && p->next->index != b->index && Intersects(p, p->next, a, b))
+                return true;
+            p = p->next;
+        } while (p != a);
+        return false;
+    }
+
+    static bool LocallyInside(const TriangulationNode *a, const TriangulationNode *b)
+    {
+        return Area(a->prev, a, a->next) < 0 ? Area(a, b, a->next) >= 0 && Area(a, a->prev, b) >= 0 : Area(a, b, a->prev) < 0 || Area(a, a->next, b) < 0;
+    }
+
+    static bool MiddleInside(const TriangulationNode *a, const TriangulationNode *b)
+    {
+        const TriangulationNode *p = a;
+        bool inside = false;
+        double px = (a->x + b->x) / 2, py = (a->y + b->y) / 2;
+        do
+        {
+            if ((p->y > py) != (p->next->y > py) && p->next->y != p->y && px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x)
+                inside = !inside;
+            p = p->next;
+        } while (p != a);
+        return inside;
+    }
+
+    static bool IsValidDiagonal(const TriangulationNode *a, const TriangulationNode *b)
+    {
+        return a->next->index != b->index && a->prev->index != b->index && !IntersectsPolygon(a, b) &&
+               ((LocallyInside(a, b) && LocallyInside(b, a) && MiddleInside(a, b) && (Area(a->prev, a, b->prev) != 0 || Area(a, b->prev, b) != 0)) ||
+                (Equals(a, b) && Area(a->prev, a, a->next) > 0 && Area(b->prev, b, b->next) > 0));
+    }
+
+    // En : Link a ring in the given orientation, counter clockwise for the outer ring and clockwise for holes.
+    // Tr : Bir halkayı verilen yönde bağla, dış halka için saat yönü tersinde ve delikler için saat yönünde.
+    TriangulationNode *LinkRing(const std::vector<glm::vec2> &points, int begin, int end, bool counterClockwise)
+    {
+        TriangulationNode *last = nullptr;
+        if (counterClockwise == (SignedArea(points, begin, end) > 0))
+            for (int i = begin; i < end; i++)
+                last = InsertNode(i, points[i], last);
+        else
+            for (int i = end - 1; i >= begin; i--)
+                last = InsertNode(i, points[i], last);
+        if (last && Equals(last, last->next))
+        {
+            RemoveNode(last);
+            last = last->next;
+        }
+        return last;
+    }
+
+    // En : Remove duplicate and collinear points between start and end.
+    // Tr : start ve end arasındaki tekrarlanan ve doğrusal noktaları kaldır.
+    static TriangulationNode *FilterPoints(TriangulationNode *start, TriangulationNode *end = nullptr)
+    {
+        if (!start)
+            return start;
+        if (!end)
+            end = start;
+        TriangulationNode *p = start;
+        bool again;
+        do
+        {
+            again = false;
+            if (!p->steiner && (Equals(p, p->next) || Area(p->prev, p, p->next) == 0))
+            {
+                RemoveNode(p);
+                p = end = p->prev;
+                if (p == p->next)
+                    break;
+                again = true;
+            }
+            else
+                p = p->next;
+        } while (again || p != end);
+        return end;
+    }
+
+    // En : Connect a and b with a diagonal, splitting the ring in two. Returns the copy of b, which is on the second ring.
+    // Tr : a ve b'yi bir köşegenle bağlayarak halkayı ikiye böl. İkinci halkada olan b'nin kopyasını döndürür.
+    TriangulationNode *SplitPolygon(TriangulationNode *a, TriangulationNode *b)
+    {
+        TriangulationNode *a2 = InsertNode(a->index, glm::vec2(a->x, a->y), nullptr);
+        TriangulationNode *b2 = InsertNode(b->index, glm::vec2(b->x, b->y), nullptr);
+        TriangulationNode *an = a->next, *bp = b->prev;
+        a->next = b;
+        b->prev = a;
+        a2->next = an;
+        an->prev = a2;
+        b2->next = a2;
+        a2->prev = b2;
+        bp->next = b2;
+        b2->prev = bp;
+        return b2;
+    }
+
+    uint32_t ZOrder(double x, double y) const
+    {
+        // En : Interleave the bits of the 15 bit grid coordinates.
+        // Tr : 15 bitlik ızgara koordinatlarının bitlerini iç içe geçir.
+        uint32_t ix = (uint32_t)((x - minX) * inverseSize), iy = (uint32_t)((y - minY) * inverseSize);
+        ix = (ix | (ix << 8)) & 0x00FF00FF;
+        ix = (ix | (ix << 4)) & 0x0F0F0F0F;
+        ix = (ix | (ix << 2)) & 0x33333333;
+        ix = (ix | (ix << 1)) & 0x55555555;
+        iy = (iy | (iy << 8)) & 0x00FF00FF;
+        iy = (iy | (iy << 4)) & 0x0F0F0F0F;
+        iy = (iy | (iy << 2)) & 0x33333333;
+        iy = (iy | (iy << 1)) & 0x55555555;
+        return ix | (iy << 1);
+    }
+
+    // En : Compute the curve index of every point and sort the z-order links with a bottom up merge sort.
+    // Tr : Her noktanın eğri indisini hesapla ve z-sıralı bağlantıları aşağıdan yukarı birleştirme sıralaması ile sırala.
+    void IndexCurve(TriangulationNode *start)
+    {
+        TriangulationNode *p = start;
+        do
+        {
+            if (p->z == 0)
+                p->z = ZOrder(p->x, p->y);
+            p->prevZ = p->prev;
+            p->nextZ = p->next;
+            p = p->next;
+        } while (p != start);
+        p->prevZ->nextZ = nullptr;
+        p->prevZ = nullptr;
+
+        TriangulationNode *list = p;
+        int inSize = 1, merges;
+        do
+        {
+            p = list;
+            list = nullptr;
+            TriangulationNode *tail = nullptr;
+            merges = 0;
+            while (p)
+            {
+                merges++;
+                TriangulationNode *q = p;
+                int pSize = 0;
+                for (int i = 0; i < inSize && q; i++)
+                {
+                    pSize++;
+                    q = q->nextZ;
+                }
+                int qSize = inSize;
+                while (pSize > 0 || (qSize > 0 && q))
+                {
+                    TriangulationNode *e;
+                    if (pSize != 0 && (qSize == 0 || !q || p->z <= q->z))
+                    {
+                        e = p;
+                        p = p->nextZ;
+                        pSize--;
+                    }
+                    else
+                    {
+                        e = q;
+                        q = q->nextZ;
+                        qSize--;
+                    }
+                    if (tail)
+                        tail->nextZ = e;
+                    else
+                        list = e;
+                    e->prevZ = tail;
+                    tail = e;
+                }
+                p = q;
+            }
+            tail->nextZ = nullptr;
+            inSize *= 2;
+        } while (merges > 1);
+    }
+
+    bool IsEar(const TriangulationNode *ear) const
+    {
+        const TriangulationNode *a = ear->prev, *b = ear, *c = ear->next;
+        if (Area(a, b, c) >= 0)
+            return false;
+        double x0 = std::min({a->x, b->x, c->x}), y0 = std::min({a->y, b->y, c->y});
+        double x1 = std::max({a->x, b->x, c->x}), y1 = std::max({a->y, b->y, c->y});
+        for (const TriangulationNode *p = c->next; p != a; p = p->next)
+            if (p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 && PointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) && Area(p->prev, p, p->next) >= 0)
+                return false;
+        return true;
+    }
+
+    // En : Same test as IsEar, but only the points whose curve index is inside the range of the bounding box are visited, walking both ways from the ear.
+    // Tr : IsEar ile aynı test, ancak yalnızca eğri indisi sınırlayıcı kutunun aralığında olan noktalar kulaktan iki yöne yürünerek ziyaret edilir.
+    bool IsEarHashed(const TriangulationNode *ear) const
+    {
+        const TriangulationNode *a = ear->prev, *b = ear, *c = ear->next;
+        if (Area(a, b, c) >= 0)
+            return false;
+        double x0 = std::min({a->x, b->x, c->x}), y0 = std::min({a->y, b->y, c->y});
+        double x1 = std::max({a->x, b->x, c->x}), y1 = std::max({a->y, b->y, c->y});
+        uint32_t minZ = ZOrder(x0, y0), maxZ = ZOrder(x1, y1);
+        auto blocks = [&](const TriangulationNode *p)
+        {
+            return p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 && p != a && p != c &&
+                   PointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) && Area(p->prev, p, p->next) >= 0;
+        };
+        const TriangulationNode *p = ear->prevZ, *n = ear->nextZ;
+        while (p && p->z >= minZ && n && n->z <= maxZ)
+        {
+            if (blocks(p) || blocks(n))
+                return false;
+            p = p->prevZ;
+            n = n->nextZ;
+        }
+        for (; p && p->z >= minZ; p = p->prevZ)
+            if (blocks(p))
+                return false;
+        for (; n && n->z <= maxZ; n = n->nextZ)
+            if (blocks(n))
+                return false;
+        return true;
+    }
+
+    // En : Clip the two ears around a self intersection of the form a-p-p.next-b.
+    // Tr : a-p-p.next-b biçimindeki bir kendi kendini kesişmenin etrafındaki iki kulağı kırp.
+    TriangulationNode *CureLocalIntersections(TriangulationNode *start)
+    {
+        TriangulationNode *p = start;
+        do
+        {
+            TriangulationNode *a = p->prev, *b = p->next->next;
+            if (!Equals(a, b) && Intersects(a, p, p->next, b) && LocallyInside(a, b) && LocallyInside(b, a))
+            {
+                triangles.insert(triangles.end(), {a->index, p->index, b->index});
+                RemoveNode(p);
+                RemoveNode(p->next);
+                p = start = b;
+            }
+            p = p->next;
+        } while (p != start);
+        return FilterPoints(p);
+    }
+
+    // En : Last resort, split the ring along any valid diagonal and clip the halves separately.
+    // Tr : Son çare, halkayı geçerli herhangi bir köşegen boyunca böl ve yarıları ayrı ayrı kırp.
+    void SplitEarcut(TriangulationNode *start)
+    {
+        TriangulationNode *a = start;
+        do
+        {
+            for (TriangulationNode *b = a->next->next; b != a->prev; b = b->next)
+                if (a->index != b->index && IsValidDiagonal(a, b))
+                {
+                    TriangulationNode *c = SplitPolygon(a, b);
+                    a = FilterPoints(a, a->next);
+                    c = FilterPoints(c, c->next);
+                    ClipEars(a, 0);
+                    ClipEars(c, 0);
+                    return;
+                }
+            a = a->next;
+        } while (a != start);
+    }
+
+    // En : Cut ears until a triangle is left. If a full turn finds none, the ring is cleaned, then cured, then split.
+    // Tr : Bir üçgen kalana kadar kulakları kes. Tam bir tur hiç bulamazsa halka temizlenir, sonra onarılır, sonra bölünür.
+    void ClipEars(TriangulationNode *ear, int pass)
+    {
+        if (!ear)
+            return;
+        if (!pass && inverseSize)
+            IndexCurve(ear);
+        TriangulationNode *stop = ear;
+        while (ear->prev != ear->next)
+        {
+            TriangulationNode *prev = ear->prev, *next = ear->next;
+            if (inverseSize ? IsEarHashed(ear) : IsEar(ear))
+            {
+                triangles.insert(triangles.end(), {prev->index, ear->index, next->index});
+                RemoveNode(ear);
+                ear = stop = next->next;
+                continue;
+            }
+            ear = next;
+            if (ear == stop)
+            {
+                if (pass == 0)
+                    ClipEars(FilterPoints(ear), 1);
+                else if (pass == 1)
+                    ClipEars(CureLocalIntersections(FilterPoints(ear)), 2);
+                else
+                    SplitEarcut(ear);
+                break;
+            }
+        }
+    }
+
+    int GridCell(double value, double origin) const
+    {
+        return std::min(gridSize - 1, std::max(0, (int)((value - origin) * gridScale)));
+    }
+
+    // En : Register the edge from p to p->next in every cell its bounding box touches. When a split changes p->next, the new edge is registered again and the old one is served by the copy of p.
+    // Tr : p'den p->next'e giden kenarı sınırlayıcı kutusunun dokunduğu her hücreye kaydet. Bir bölme p->next'i değiştirdiğinde yeni kenar tekrar kaydedilir ve eskisine p'nin kopyası hizmet eder.
+    void RegisterEdge(TriangulationNode *p)
+    {
+        int x0 = GridCell(std::min(p->x, p->next->x), gridX), x1 = GridCell(std::max(p->x, p->next->x), gridX);
+        int y0 = GridCell(std::min(p->y, p->next->y), gridY), y1 = GridCell(std::max(p->y, p->next->y), gridY);
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                gridEdges[y * gridSize + x].push_back(p);
+    }
+
+    void RegisterPoint(TriangulationNode *p)
+    {
+        gridPoints[GridCell(p->y, gridY) * gridSize + GridCell(p->x, gridX)].push_back(p);
+    }
+
+    void RegisterRing(TriangulationNode *start)
+    {
+        TriangulationNode *p = start;
+        do
+        {
+            RegisterEdge(p);
+            RegisterPoint(p);
+            p = p->next;
+        } while (p != start);
+    }
+
+    // En : Find the point of the joined rings that the leftmost point of a hole can see. The ray to the left only visits the cells of its row until a hit is closer than the next cell.
+    // Tr : Birleştirilmiş halkaların, bir deliğin en soldaki noktasının görebildiği noktasını bul. Sola giden ışın, bir isabet sonraki hücreden daha yakın olana kadar yalnızca kendi satırının hücrelerini ziyaret eder.
+    TriangulationNode *FindHoleBridge(TriangulationNode *hole) const
+    {
+        TriangulationNode *m = nullptr;
+        double hx = hole->x, hy = hole->y, qx = -INFINITY;
+        int row = GridCell(hy, gridY);
+        for (int column = GridCell(hx, gridX); column >= 0; column--)
+        {
+            for (TriangulationNode *p : gridEdges[row * gridSize + column])
+                if (hy <= p->y && hy >= p->next->y && p->next->y != p->y)
+                {
+                    double x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);
+                    if (x <= hx && x > qx)
+                    {
+                        qx = x;
+                        m = p->x < p->next->x ? p : p->next;
+                        if (x == hx)
+                            return m;
+                    }
+                }
+            if (qx >= gridX + column / gridScale)
+                break;
+        }
+        if (!m)
+            return nullptr;
+
+        // En : Points inside the triangle of the hole point, the ray hit and m may block the view. The one with the smallest angle to the ray is taken.
+        // Tr : Delik noktası, ışın isabeti ve m üçgeninin içindeki noktalar görüşü engelleyebilir. Işına en küçük açıyla olan alınır.
+        double mx = m->x, my = m->y, tanMin = INFINITY;
+        int x0 = GridCell(mx, gridX), x1 = GridCell(hx, gridX);
+        int y0 = GridCell(std::min(hy, my), gridY), y1 = GridCell(std::max(hy, my), gridY);
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                for (TriangulationNode *p : gridPoints[y * gridSize + x])
+                    if (hx >= p->x && p->x >= mx && hx != p->x && PointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y))
+                    {
+                        double tan = std::abs(hy - p->y) / (hx - p->x);
+                        if (LocallyInside(p, hole) && (tan < tanMin || (tan == tanMin && (p->x > m->x || (p->x == m->x && Area(m->prev, m, p->prev) < 0 && Area(p->next, m, m->next) < 0)))))
+                        {
+                            m = p;
+                            tanMin = tan;
+                        }
+                    }
+        return m;
+    }
+
+    TriangulationNode *EliminateHoles(const std::vector<glm::vec2> &points, const std::vector<int> &holes, TriangulationNode *outer)
+    {
+        std::vector<TriangulationNode *> queue;
+        for (int i = 0; i < (int)holes.size(); i++)
+        {
+            int end = i + 1 < (int)holes.size() ? holes[i + 1] : points.size();
+            TriangulationNode *list = LinkRing(points, holes[i], end, false);
+            if (!list)
+                continue;
+            if (list == list->next)
+                list->steiner = true;
+            TriangulationNode *p = list, *leftmost = list;
+            do
+            {
+                if (p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y))
+                    leftmost = p;
+                p = p->next;
+            } while (p != list);
+            queue.push_back(leftmost);
+        }
+
+        // En : The grid has about four points per cell. Only the outer ring is registered at first, every hole joins it once it is bridged.
+        // Tr : Izgarada hücre başına yaklaşık dört nokta vardır. İlk başta yalnızca dış halka kaydedilir, her delik köprülendiğinde ona katılır.
+        glm::vec2 low = points[0], high = points[0];
+        for (const glm::vec2 &point : points)
+        {
+            low = glm::min(low, point);
+            high = glm::max(high, point);
+        }
+        double extent = std::max(high.x - low.x, high.y - low.y);
+        gridSize = std::max(1, std::min(1024, (int)std::sqrt(points.size() / 4.0)));
+        gridX = low.x;
+        gridY = low.y;
+        gridScale = extent > 0 ? gridSize / extent : 0;
+        gridEdges.assign(gridSize * gridSize, std::vector<TriangulationNode *>());
+        gridPoints.assign(gridSize * gridSize, std::vector<TriangulationNode *>());
+        RegisterRing(outer);
+
+        // En : Holes are bridged from left to right, so that a bridge never crosses a hole that is not bridged yet. Points are not filtered until every hole is bridged, so the registered nodes stay linked.
+        // Tr : Delikler soldan sağa köprülenir, böylece bir köprü henüz köprülenmemiş bir deliği asla kesmez. Her delik köprülenene kadar noktalar filtrelenmez, böylece kaydedilen düğümler bağlı kalır.
+        std::sort(queue.begin(), queue.end(), [](const TriangulationNode *a, const TriangulationNode *b)
+                  { return a->x < b->x || (a->x == b->x && a->y < b->y); });
+        for (TriangulationNode *hole : queue)
+        {
+            TriangulationNode *bridge = FindHoleBridge(hole);
+            if (!bridge)
+                continue;
+            RegisterRing(hole);
+            TriangulationNode *bridgeReverse = SplitPolygon(bridge, hole);
+            TriangulationNode *bridgeCopy = bridgeReverse->next;
+            RegisterEdge(bridge);
+            RegisterEdge(bridgeReverse);
+            RegisterEdge(bridgeCopy);
+            RegisterPoint(bridgeReverse);
+            RegisterPoint(bridgeCopy);
+        }
+        gridEdges.clear();
+        gridPoints.clear();
+        return outer;
+    }
+
+public:
+    Triangulator(std::vector<int> &triangles) : triangles(triangles) {}
+
+    void Run(const std::vector<glm::vec2> &points, const std::vector<int> &holes)
+    {
+        int outerEnd = holes.empty() ? points.size() : holes[0];
+        TriangulationNode *outer = LinkRing(points, 0, outerEnd, true);
+        if (!outer || outer->next == outer->prev)
+            return;
+        if (!holes.empty())
+            outer = EliminateHoles(points, holes, outer);
+        if ((int)points.size() > TriangulationHashThreshold)
+        {
+            glm::vec2 low = points[0], high = points[0];
+            for (int i = 1; i < outerEnd; i++)
+            {
+                low = glm::min(low, points[i]);
+                high = glm::max(high, points[i]);
+            }
+            minX = low.x;
+            minY = low.y;
+            double size = std::max(high.x - low.x, high.y - low.y);
+            inverseSize = size != 0 ? 32767 / size : 0;
+        }
+        ClipEars(outer, 0);
+    }
+};
+
+double SignedArea(const std::vector<glm::vec2> &points, int begin, int end)
+{
+    double sum = 0;
+    for (int i = begin, j = end - 1; i < end; j = i++)
+        sum += ((double)points[j].x - points[i].x) * ((double)points[i].y + points[j].y);
+    return sum;
+}
+
+std::vector<int> Triangulate(const std::vector<glm::vec2> &points, const std::vector<int> &holes)
+{
+    std::vector<int> triangles;
+    if (points.size() < 3)
+        return triangles;
+    triangles.reserve((points.size() + 2 * holes.size()) * 3);
+    Triangulator(triangles).Run(points, holes);
+    return triangles;
+}
+
+#ifdef BENCHMARK
+void BenchmarkTriangulation()
+{
+    // En : Jagged circles have a reflex corner at every other point, the worst case of plain ear clipping. The teeth are as deep as a few edges, like the detail of a real outline. The holed case punches a grid of square holes into a circle.
+    // Tr : Tırtıklı dairelerin her iki noktadan birinde içbükey köşesi vardır, düz kulak kırpmanın en kötü durumu. Dişler, gerçek bir dış çizginin ayrıntısı gibi birkaç kenar derinliğindedir. Delikli durum bir daireye kare deliklerden oluşan bir ızgara açar.
+    for (int count : {10000, 100000, 1000000})
+    {
+        std::vector<glm::vec2> jagged(count);
+        for (int i = 0; i < count; i++)
+        {
+            float angle = 2 * 3.14159265f * i / count, radius = i % 2 ? 1.0f - 12.0f / count : 1.0f;
+            jagged[i] = glm::vec2(radius * std::cos(angle), radius * std::sin(angle));
+        }
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<int> triangles = Triangulate(jagged, {});
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Triangulate jagged circle, " << count << " points : " << ms << " ms, " << triangles.size() / 3 << " triangles" << std::endl;
+    }
+    for (int side : {10, 30, 100})
+    {
+        int outerCount = 10000;
+        std::vector<glm::vec2> points;
+        std::vector<int> holes;
+        for (int i = 0; i < outerCount; i++)
+        {
+            float angle = 2 * 3.14159265f * i / outerCount;
+            points.push_back(glm::vec2(std::cos(angle), std::sin(angle)));
+        }
+        float cell = 1.2f / side;
+        for (int y = 0; y < side; y++)
+            for (int x = 0; x < side; x++)
+            {
+                glm::vec2 center = glm::vec2(-0.6f + (x + 0.5f) * cell, -0.6f + (y + 0.5f) * cell);
+                holes.push_back(points.size());
+                for (glm::vec2 corner : {glm::vec2(-1, -1), glm::vec2(1, -1), glm::vec2(1, 1), glm::vec2(-1, 1)})
+                    points.push_back(center + corner * cell * 0.25f);
+            }
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<int> triangles = Triangulate(points, holes);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Triangulate circle with " << holes.size() << " holes, " << points.size() << " points : " << ms << " ms, " << triangles.size() / 3 << " triangles" << std::endl;
+    }
+}
+#endif
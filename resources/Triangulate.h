@@ -0,0 +1,26 @@
+// En : This file contains the function prototypes for triangulating polygons with holes.
+// Tr : Bu dosya, delikli çokgenleri üçgenleyen fonksiyonların prototiplerini içerir.
+#include <glm/glm.hpp>
+#include <vector>
+#ifndef TRIANGULATE_H
+#define TRIANGULATE_H
+
+// En : Triangulate a simple polygon by ear clipping. points holds the outer ring followed by the hole rings, holes holds the first point of every hole. Rings may have any orientation.
+// Tr : Basit bir çokgeni kulak kırpma ile üçgenle. points dış halkayı ve ardından delik halkalarını, holes her deliğin ilk noktasını tutar. Halkalar herhangi bir yönde olabilir.
+// En : Holes are bridged into the outer ring first, finding the bridges through a uniform grid of the rings. Polygons with more than a few dozen points index their vertices along a z-order curve, so an ear is only tested against the points inside its bounding box instead of the whole ring.
+// Tr : Delikler önce dış halkaya köprülenir, köprüler halkaların düzgün bir ızgarası üzerinden bulunur. Birkaç düzineden fazla noktası olan çokgenler köşelerini bir z-sıralı eğri boyunca indeksler, böylece bir kulak bütün halka yerine yalnızca sınırlayıcı kutusundaki noktalara karşı test edilir.
+// En : Returns three indices into points per triangle, all with the orientation of the outer ring.
+// Tr : Üçgen başına points dizisine üç indis döndürür, hepsi dış halkanın yönünde.
+std::vector<int> Triangulate(const std::vector<glm::vec2> &points, const std::vector<int> &holes);
+
+// En : Twice the signed area of the ring [begin, end) of points, positive for counter clockwise rings.
+// Tr : points dizisinin [begin, end) halkasının işaretli alanının iki katı, saat yönü tersindeki halkalar için pozitif.
+double SignedArea(const std::vector<glm::vec2> &points, int begin, int end);
+
+#ifdef BENCHMARK
+// En : Time the triangulation of generated polygons of 10k points and more, with and without holes.
+// Tr : 10 bin ve daha fazla noktalı oluşturulmuş çokgenlerin deliksiz ve delikli üçgenlenmesinin süresini ölç.
+void BenchmarkTriangulation();
+#endif
+
+#endif